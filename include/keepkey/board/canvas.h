@@ -33,6 +33,13 @@ typedef struct
 	uint16_t 	height;
 	uint16_t 	width;
 	bool 		dirty;
+
+	/* Bounding box of the pixels changed since the last refresh, with
+	 * exclusive end coordinates. Only meaningful while dirty is set. */
+	uint16_t 	dirty_x0;
+	uint16_t 	dirty_y0;
+	uint16_t 	dirty_x1;
+	uint16_t 	dirty_y1;
 } Canvas;
 
 #endif
@@ -49,6 +49,8 @@ typedef struct
 
 /* === Functions =========================================================== */
 
+void draw_mark_dirty(Canvas *canvas, uint16_t x, uint16_t y, uint16_t width,
+                     uint16_t height);
 bool draw_char_with_shift(Canvas *canvas, DrawableParams *p,
                           uint16_t *x_shift, uint16_t *y_shift, const CharacterImage *img);
 void draw_string(Canvas *canvas, const Font *font, const char *c, DrawableParams *p,
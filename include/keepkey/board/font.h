@@ -26,10 +26,14 @@
 
 /* === Typedefs ============================================================ */
 
-/* Data pertaining to the image of a character */
+/* Widest glyph that fits in a row mask */
+#define FONT_MAX_GLYPH_WIDTH 16
+
+/* Data pertaining to the image of a character. Each row is a 1bpp mask with
+ * bit x set where pixel x is drawn. */
 typedef struct
 {
-    const uint8_t  *data;
+    const uint16_t *rows;
     uint16_t        width;
     uint16_t        height;
 } CharacterImage;
@@ -43,12 +47,19 @@ typedef struct
 } Character;
 
 
+/* Characters codes covered by a font's lookup tables */
+#define FONT_TABLE_SIZE 128
+
 /* A complete font package. */
 typedef struct
 {
     int                 length;
     int                 size;
     const Character    *characters;
+
+    /* Images and widths, indexed by character code */
+    const CharacterImage *const *table;
+    const uint8_t      *widths;
 } Font;
 
 /* === Functions =========================================================== */
@@ -58,6 +69,7 @@ const Font *get_title_font(void);
 const Font *get_body_font(void);
 
 const CharacterImage *font_get_char(const Font *font, char c);
+uint32_t font_char_width(const Font *font, char c);
 
 uint32_t font_height(const Font *font);
 uint32_t font_width(const Font *font);
@@ -29,7 +29,7 @@
 
 #define ONE_SEC         1100    /* Count for 1 second  */
 #define HALF_SEC        500     /* Count for 0.5 second */
-#define MAX_RUNNABLES   3       /* Max number of queue for task manager */
+#define MAX_RUNNABLES   4       /* Max number of queue for task manager */
 
 /* === Typedefs ============================================================ */
 
@@ -70,6 +70,7 @@ void kk_timer_init(void);
 void timer_init(void);
 void delay_ms(uint32_t ms);
 void delay_us(uint32_t us);
+uint32_t timer_ticks(void);
 void delay_ms_with_callback(uint32_t ms, callback_func_t callback_func,
                             uint32_t frequency_ms);
 void post_delayed(Runnable runnable, void *context, uint32_t ms_delay);
@@ -78,4 +79,9 @@ void post_periodic(Runnable runnable, void *context, uint32_t period_ms,
 void remove_runnable(Runnable runnable);
 void clear_runnables(void);
 
+#ifdef EMULATOR
+uint32_t timer_next_deadline_ms(void);
+void timer_advance(void);
+#endif
+
 #endif
\ No newline at end of file
@@ -20,13 +20,23 @@
 #ifndef __EMULATOR_H__
 #define __EMULATOR_H__
 
+#include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 void emulatorPoll(void);
 void emulatorRandom(void *buffer, size_t size);
 
+void emulatorSetFlashPath(const char *path);
+void emulatorSetUdpPort(int port);
+void emulatorFlashSync(const void *addr, size_t len);
+void emulatorSetFramebufferName(const char *name);
+void emulatorPublishFrame(const uint8_t *pixels, uint16_t width, uint16_t height,
+                          uint16_t y0, uint16_t y1);
+
 void emulatorSocketInit(void);
 size_t emulatorSocketRead(int *iface, void *buffer, size_t size);
 size_t emulatorSocketWrite(int iface, const void *buffer, size_t size);
+bool emulatorSocketWait(int timeout_ms);
 
 #endif
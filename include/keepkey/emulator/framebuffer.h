@@ -0,0 +1,49 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2018 KeepKey
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef KEEPKEY_EMULATOR_FRAMEBUFFER_H
+#define KEEPKEY_EMULATOR_FRAMEBUFFER_H
+
+/*
+ * Layout of the POSIX shared memory segment the emulator publishes its
+ * canvas to, when started with --framebuffer NAME (or $KEEPKEY_FRAMEBUFFER).
+ *
+ * The segment is only written when the canvas was dirty at display_refresh().
+ * sequence is odd while a frame is being written, and advances by two for
+ * every published frame, so a reader takes a consistent copy by loading
+ * sequence (acquire), copying pixels, and checking sequence is still the
+ * same even value.
+ */
+
+#include <stdint.h>
+
+#define EMULATOR_FRAMEBUFFER_ENV    "KEEPKEY_FRAMEBUFFER"
+#define EMULATOR_FRAMEBUFFER_MAGIC  0x42464b4b  /* "KKFB" */
+
+typedef struct {
+    uint32_t magic;
+    uint16_t width;
+    uint16_t height;
+    uint32_t sequence;
+    uint32_t reserved;
+    /* width * height bytes, one 8-bit grey level per pixel, row major */
+    uint8_t pixels[];
+} EmulatorFramebuffer;
+
+#endif
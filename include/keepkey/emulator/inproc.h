@@ -0,0 +1,51 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2018 KeepKey
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef KEEPKEY_EMULATOR_INPROC_H
+#define KEEPKEY_EMULATOR_INPROC_H
+
+/*
+ * In-process host transport.  Link kkemulator.inproc instead of kkemulator
+ * and the firmware's USB reports are exchanged through in-memory queues with
+ * a test driver in the same process, rather than over UDP.  The driver
+ * queues reports with emulatorInprocSend(), or whole messages with
+ * emulatorInprocSendMessage(), runs usb_poll() until
+ * emulatorInprocPending() drops to zero, and collects the replies with
+ * emulatorInprocRecv().
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define INPROC_IFACE_MAIN   0
+#define INPROC_IFACE_DEBUG  1
+
+/* Called for every report the firmware sends, in place of queueing it */
+typedef void (*emulator_inproc_tx_hook_t)(int iface, const uint8_t *report,
+                                          size_t size, void *context);
+
+void emulatorInprocReset(void);
+bool emulatorInprocSend(int iface, const void *report, size_t size);
+bool emulatorInprocSendMessage(int iface, uint16_t id, const void *payload, uint32_t size);
+size_t emulatorInprocPending(int iface);
+size_t emulatorInprocRecv(int iface, void *report, size_t size);
+void emulatorInprocSetTxHook(emulator_inproc_tx_hook_t hook, void *context);
+
+#endif
@@ -57,6 +57,17 @@ int cryptoMessageDecrypt(curve_point *nonce, uint8_t *payload, size_t payload_le
                          size_t *msg_len, bool *display_only, bool *signing, uint8_t *address_raw);
 */
 
+/// \brief Derive address_n from the root node in inout, reusing account-level
+///        intermediate nodes derived earlier in this session.
+/// \returns 1 on success, 0 on derivation failure.
+int cryptoDeriveNodeCached(HDNode *inout, const uint32_t *address_n, size_t address_n_count, uint32_t *fingerprint);
+
+/// \brief Zeroize the session derivation cache, and reset its counters.
+void cryptoClearDerivationCache(void);
+
+/// \brief Fetch the derivation cache hit/miss counters.
+void cryptoGetDerivationCacheStats(uint32_t *hits, uint32_t *misses);
+
 uint8_t *cryptoHDNodePathToPubkey(const CoinType *coin, const HDNodePathType *hdnodepath);
 int cryptoMultisigPubkeyIndex(const CoinType *coin, const MultisigRedeemScriptType *multisig,
                               const uint8_t *pubkey);
@@ -20,6 +20,7 @@
 #ifndef SIGNING_H
 #define SIGNING_H
 
+#include "keepkey/board/msg_dispatch.h"
 #include "trezor/crypto/bip32.h"
 #include "keepkey/transport/interface.h"
 
@@ -28,6 +29,7 @@
 void signing_init(const SignTx *msg, const CoinType *_coin, const HDNode *_root);
 void signing_abort(void);
 void signing_txack(TransactionType *tx);
+void signing_raw_txack(RawMessage *msg, uint32_t frame_length);
 void send_fsm_co_error_message(int co_error);
 
 #endif
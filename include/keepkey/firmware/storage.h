@@ -43,9 +43,17 @@ void storage_reset(void);
 void session_clear(bool clear_pin);
 
 /// \brief Write content of configuration in shadow memory to storage partion
-///        in flash.
+///        in flash. Flushes any pending deferred commit.
 void storage_commit(void);
 
+/// \brief Schedule a commit, so that several changes made within a short
+///        window are written to flash in a single erase/program cycle.
+void storage_commitDeferred(void);
+
+/// \brief Perform a deferred commit, if its window has elapsed. Must be called
+///        from the main loop, and not from interrupt context.
+void storage_commitPending(void);
+
 /// \brief Load configuration data from usb message to shadow memory
 typedef struct _LoadDevice LoadDevice;
 void storage_loadDevice(LoadDevice *msg);
@@ -57,6 +65,10 @@ void storage_loadDevice(LoadDevice *msg);
 /// \return true iff the root node was found.
 bool storage_getRootNode(const char *curve, bool usePassphrase, HDNode *node);
 
+/// \brief Whether the last storage_getRootNode() failed because the host sent
+///        Cancel or Initialize while the seed was being derived.
+bool storage_seedJobWasCancelled(void);
+
 /// \brief Fetch the node used for U2F signing.
 /// \returns true iff retrieval was successful.
 bool storage_getU2FRoot(HDNode *node);
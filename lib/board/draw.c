@@ -30,6 +30,48 @@
 #pragma GCC push_options
 #pragma GCC optimize("-O3")
 
+/*
+ * draw_mark_dirty() - Grow the canvas' dirty bounding box to cover a region
+ *
+ * INPUT
+ *     - canvas: canvas
+ *     - x: left edge of region
+ *     - y: top edge of region
+ *     - width: width of region
+ *     - height: height of region
+ * OUTPUT
+ *     none
+ */
+void draw_mark_dirty(Canvas *canvas, uint16_t x, uint16_t y, uint16_t width,
+                     uint16_t height)
+{
+    uint16_t x1 = x + width;
+    uint16_t y1 = y + height;
+
+    x1 = (x1 > canvas->width) ? canvas->width : x1;
+    y1 = (y1 > canvas->height) ? canvas->height : y1;
+
+    if(x >= x1 || y >= y1)
+    {
+        return;
+    }
+
+    if(!canvas->dirty)
+    {
+        canvas->dirty_x0 = x;
+        canvas->dirty_y0 = y;
+        canvas->dirty_x1 = x1;
+        canvas->dirty_y1 = y1;
+        canvas->dirty = true;
+        return;
+    }
+
+    canvas->dirty_x0 = (x < canvas->dirty_x0) ? x : canvas->dirty_x0;
+    canvas->dirty_y0 = (y < canvas->dirty_y0) ? y : canvas->dirty_y0;
+    canvas->dirty_x1 = (x1 > canvas->dirty_x1) ? x1 : canvas->dirty_x1;
+    canvas->dirty_y1 = (y1 > canvas->dirty_y1) ? y1 : canvas->dirty_y1;
+}
+
 /*
  * draw_char_with_shift() - Draw image on display with left/top margins
  *
@@ -52,37 +94,32 @@ bool draw_char_with_shift(Canvas *canvas, DrawableParams *p,
     if (start_index >= (KEEPKEY_DISPLAY_HEIGHT * KEEPKEY_DISPLAY_WIDTH)){
         return false;
     }
-    uint8_t *canvas_pixel = &canvas->buffer[ start_index ];
-    uint8_t *canvas_end = &canvas->buffer[canvas->width * canvas->height];
+    uint8_t *canvas_row = &canvas->buffer[ start_index ];
 
     /* Check that this was a character that we have in the font */
     if(img != NULL)
     {
         /* Check that it's within bounds. */
         if(((img->width + p->x) <= canvas->width) &&
-                ((img->height + p->y) <= canvas->height))
+                ((img->height + p->y) <= canvas->height) &&
+                (img->width <= FONT_MAX_GLYPH_WIDTH))
         {
-            const uint8_t *img_pixel = &img->data[ 0 ];
-
-            int y;
-
-            for(y = 0; y < img->height; y++)
+            for(int y = 0; y < img->height; y++)
             {
-                int x;
+                /* Visit only the set pixels of each row mask */
+                uint32_t mask = img->rows[ y ];
 
-                for(x = 0; x < img->width; x++)
+                while(mask)
                 {
-                    if (canvas_pixel >= canvas_end){
-                        return false; // defensive bounds check
-                    }
-                    *canvas_pixel = (*img_pixel == 0x00) ? p->color : *canvas_pixel;
-                    canvas_pixel++;
-                    img_pixel++;
+                    canvas_row[ __builtin_ctz(mask) ] = p->color;
+                    mask &= mask - 1;
                 }
 
-                canvas_pixel += (canvas->width - img->width);
+                canvas_row += canvas->width;
             }
 
+            draw_mark_dirty(canvas, p->x, p->y, img->width, img->height);
+
             if(x_shift != NULL)
             {
                 *x_shift += img->width;
@@ -97,8 +134,6 @@ bool draw_char_with_shift(Canvas *canvas, DrawableParams *p,
         }
     }
 
-    canvas->dirty = true;
-
     return(ret_stat);
 }
 
@@ -146,7 +181,7 @@ void draw_string(Canvas *canvas, const Font *font, const char *str_write,
 
             while(*next_c && *next_c != ' ' && *next_c != '\n')
             {
-                word_width += font_get_char(font, *next_c)->width;
+                word_width += font_char_width(font, *next_c);
                 next_c++;
             }
         }
@@ -170,8 +205,6 @@ void draw_string(Canvas *canvas, const Font *font, const char *str_write,
         have_space = draw_char_with_shift(canvas, &char_params, &x_offset, NULL, img);
         str_write++;
     }
-
-    canvas->dirty = true;
 }
 
 /*
@@ -192,8 +225,6 @@ void draw_char(Canvas *canvas, const Font *font, char c, DrawableParams *p)
 
     /* Draw Character */
     draw_char_with_shift(canvas, p, &x_offset, NULL, img);
-
-    canvas->dirty = true;
 }
 
 /*
@@ -263,7 +294,7 @@ void draw_box(Canvas *canvas, BoxDrawableParams *p)
         canvas_pixel += (canvas->width - width);
     }
 
-    canvas->dirty = true;
+    draw_mark_dirty(canvas, start_col, start_row, width, height);
 }
 
 /*
@@ -285,9 +316,39 @@ void draw_box_simple(Canvas *canvas, uint8_t color, uint16_t x, uint16_t y, uint
     draw_box(canvas, &box_params);
 }
 
+/*
+ * draw_color_lut() - Get the table that scales image intensities by a color
+ *
+ * INPUT
+ *     - color: frame color
+ * OUTPUT
+ *     256-entry table of scaled pixel values
+ */
+static const uint8_t *draw_color_lut(uint8_t color)
+{
+    static uint8_t lut[256];
+    static int lut_color = -1;
+
+    if(lut_color != color)
+    {
+        for(int i = 0; i < 256; i++)
+        {
+            lut[i] = (uint8_t)(i * color / 100);
+        }
+
+        lut_color = color;
+    }
+
+    return lut;
+}
+
 /*
  * draw_bitmap_mono_rle() - Draw image
  *
+ *     The image is a stream of runs: a positive count n followed by one pixel
+ *     repeated n times, or a negative count -n followed by n literal pixels.
+ *     Runs may wrap across rows, and are drawn one row span at a time.
+ *
  * INPUT
  *     - canvas: canvas
  *     - frame: pointer to animation frame
@@ -301,67 +362,78 @@ bool draw_bitmap_mono_rle(Canvas *canvas, const AnimationFrame *frame, bool eras
     }
 
     const Image *img = frame->image;
-    const uint8_t color = erase ? 0x0 : frame->color;
+    const uint8_t *lut = draw_color_lut(erase ? 0x0 : frame->color);
 
-    /* Check that image will fit in bounds */
+    /* Check that image will fit in bounds, so every span below is in bounds */
     if(((img->w + frame->x) > canvas->width) ||
             ((img->h + frame->y) > canvas->height))
     {
         return false;
     }
 
-    int8_t sequence = 0;
-    int8_t nonsequence = 0;
-    uint32_t pixel_index = 0;
+    const uint32_t num_pixels = (uint32_t)img->w * img->h;
+    uint32_t pixel = 0;
+    uint32_t data_index = 0;
+    uint16_t x0 = 0;
+    uint8_t *row = &canvas->buffer[ frame->y * canvas->width + frame->x ];
 
-    for(int y0 = 0; y0 < img->h; y0++)
+    while(pixel < num_pixels)
     {
-        for(int x0 = 0; x0 < img->w; x0++)
+        if(data_index >= img->length)
         {
+            return false;
+        }
 
-            if (pixel_index >= img->length){
-                return false; // defensive bounds check
-            }
+        const int8_t run = (int8_t)img->data[ data_index++ ];
+        const bool repeat = run > 0;
+        uint32_t count = repeat ? (uint32_t)run : (uint32_t)-run;
 
-            // sequence > 0 implies the next x pixels are the same
-            // sequence < 0 implies the next -x pixels are all different
-            if((sequence == 0) && (nonsequence == 0))
-            {
-                sequence = img->data[pixel_index];
-                pixel_index++;
+        if(count == 0 || data_index + (repeat ? 1 : count) > img->length)
+        {
+            return false;
+        }
+
+        const uint8_t *src = &img->data[ data_index ];
+        data_index += repeat ? 1 : count;
+
+        if(count > num_pixels - pixel)
+        {
+            count = num_pixels - pixel;
+        }
 
-                if(sequence < 0)
+        pixel += count;
+
+        while(count > 0)
+        {
+            uint16_t span = img->w - x0;
+            span = (count < span) ? count : span;
+
+            if(repeat)
+            {
+                memset(row + x0, lut[ *src ], span);
+            }
+            else
+            {
+                for(uint16_t i = 0; i < span; i++)
                 {
-                    nonsequence = -sequence;
-                    sequence = 0;
+                    row[ x0 + i ] = lut[ src[ i ] ];
                 }
-            }
 
-            if (pixel_index >= img->length){
-                return false; // defensive bounds check
+                src += span;
             }
 
-            const uint32_t canvas_index = ((frame->y + y0) * canvas->width) + frame->x + x0;
-            canvas->buffer[canvas_index] = (uint8_t)((int)img->data[pixel_index] * color / 100);
+            count -= span;
+            x0 += span;
 
-            if(sequence > 0)
+            if(x0 == img->w)
             {
-                sequence--;
-                if(sequence == 0)
-                {
-                    pixel_index++;
-                }
-            } 
-            else 
-            { 
-                assert(nonsequence > 0);
-                pixel_index++;
-                nonsequence--;
+                x0 = 0;
+                row += canvas->width;
             }
         }
     }
 
-    canvas->dirty = true;
+    draw_mark_dirty(canvas, frame->x, frame->y, img->w, img->h);
     return true;
 }
 #pragma GCC pop_options
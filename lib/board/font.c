@@ -27,171 +27,171 @@
 
 /* --- Pin Font ------------------------------------------------------------ */
 
-static const uint8_t image_font_sadface_9x10[9 * 10] =
-{
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-    0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00,
-    0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00,
-    0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,
-    0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff
+static const uint16_t image_font_sadface_9x10[10] =
+{
+    0x00fe, /* .#######. */
+    0x0101, /* #.......# */
+    0x01ab, /* ##.#.#.## */
+    0x0145, /* #.#...#.# */
+    0x01ab, /* ##.#.#.## */
+    0x0101, /* #.......# */
+    0x0139, /* #..###..# */
+    0x0145, /* #.#...#.# */
+    0x0101, /* #.......# */
+    0x00fe  /* .#######. */
 };
 static const CharacterImage sadface_9x10 = { image_font_sadface_9x10, 9, 10};
 
-static const uint8_t image_data_pin_font_0x31[48] =
-{
-    0xff, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00
+static const uint16_t image_data_pin_font_0x31[12] =
+{
+    0x000e, /* .### */
+    0x000f, /* #### */
+    0x000f, /* #### */
+    0x000c, /* ..## */
+    0x000c, /* ..## */
+    0x000c, /* ..## */
+    0x000c, /* ..## */
+    0x000c, /* ..## */
+    0x000c, /* ..## */
+    0x000c, /* ..## */
+    0x000c, /* ..## */
+    0x000c  /* ..## */
 };
 static const CharacterImage pin_font_0x31 = { image_data_pin_font_0x31, 4, 12};
 
-static const uint8_t image_data_pin_font_0x32[96] =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+static const uint16_t image_data_pin_font_0x32[12] =
+{
+    0x003f, /* ######.. */
+    0x007f, /* #######. */
+    0x00c0, /* ......## */
+    0x00c0, /* ......## */
+    0x00c0, /* ......## */
+    0x007c, /* ..#####. */
+    0x003e, /* .#####.. */
+    0x0003, /* ##...... */
+    0x0003, /* ##...... */
+    0x0003, /* ##...... */
+    0x00ff, /* ######## */
+    0x00ff  /* ######## */
 };
 static const CharacterImage pin_font_0x32 = { image_data_pin_font_0x32, 8, 12};
 
-static const uint8_t image_data_pin_font_0x33[96] =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff
+static const uint16_t image_data_pin_font_0x33[12] =
+{
+    0x003f, /* ######.. */
+    0x007f, /* #######. */
+    0x00c0, /* ......## */
+    0x00c0, /* ......## */
+    0x00c0, /* ......## */
+    0x007e, /* .######. */
+    0x007e, /* .######. */
+    0x00c0, /* ......## */
+    0x00c0, /* ......## */
+    0x00c0, /* ......## */
+    0x007f, /* #######. */
+    0x003f  /* ######.. */
 };
 static const CharacterImage pin_font_0x33 = { image_data_pin_font_0x33, 8, 12};
 
-static const uint8_t image_data_pin_font_0x34[96] =
-{
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff
+static const uint16_t image_data_pin_font_0x34[12] =
+{
+    0x0078, /* ...####. */
+    0x0078, /* ...####. */
+    0x006c, /* ..##.##. */
+    0x006c, /* ..##.##. */
+    0x0066, /* .##..##. */
+    0x0066, /* .##..##. */
+    0x0063, /* ##...##. */
+    0x00ff, /* ######## */
+    0x00ff, /* ######## */
+    0x0060, /* .....##. */
+    0x0060, /* .....##. */
+    0x0060  /* .....##. */
 };
 static const CharacterImage pin_font_0x34 = { image_data_pin_font_0x34, 8, 12};
 
-static const uint8_t image_data_pin_font_0x35[96] =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff
+static const uint16_t image_data_pin_font_0x35[12] =
+{
+    0x00ff, /* ######## */
+    0x00ff, /* ######## */
+    0x0003, /* ##...... */
+    0x0003, /* ##...... */
+    0x0003, /* ##...... */
+    0x003f, /* ######.. */
+    0x007e, /* .######. */
+    0x00c0, /* ......## */
+    0x00c0, /* ......## */
+    0x00c0, /* ......## */
+    0x007f, /* #######. */
+    0x003e  /* .#####.. */
 };
 static const CharacterImage pin_font_0x35 = { image_data_pin_font_0x35, 8, 12};
 
-static const uint8_t image_data_pin_font_0x36[96] =
-{
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff
+static const uint16_t image_data_pin_font_0x36[12] =
+{
+    0x003c, /* ..####.. */
+    0x007e, /* .######. */
+    0x0003, /* ##...... */
+    0x0003, /* ##...... */
+    0x0003, /* ##...... */
+    0x003f, /* ######.. */
+    0x007f, /* #######. */
+    0x00c3, /* ##....## */
+    0x00c3, /* ##....## */
+    0x00c3, /* ##....## */
+    0x007e, /* .######. */
+    0x003c  /* ..####.. */
 };
 static const CharacterImage pin_font_0x36 = { image_data_pin_font_0x36, 8, 12};
 
-static const uint8_t image_data_pin_font_0x37[96] =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff
+static const uint16_t image_data_pin_font_0x37[12] =
+{
+    0x00ff, /* ######## */
+    0x00ff, /* ######## */
+    0x00c0, /* ......## */
+    0x00c0, /* ......## */
+    0x0060, /* .....##. */
+    0x0060, /* .....##. */
+    0x0030, /* ....##.. */
+    0x0030, /* ....##.. */
+    0x0018, /* ...##... */
+    0x0018, /* ...##... */
+    0x000c, /* ..##.... */
+    0x000c  /* ..##.... */
 };
 static const CharacterImage pin_font_0x37 = { image_data_pin_font_0x37, 8, 12};
 
-static const uint8_t image_data_pin_font_0x38[96] =
-{
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff
+static const uint16_t image_data_pin_font_0x38[12] =
+{
+    0x003c, /* ..####.. */
+    0x007e, /* .######. */
+    0x00c3, /* ##....## */
+    0x00c3, /* ##....## */
+    0x00c3, /* ##....## */
+    0x007e, /* .######. */
+    0x007e, /* .######. */
+    0x00c3, /* ##....## */
+    0x00c3, /* ##....## */
+    0x00c3, /* ##....## */
+    0x007e, /* .######. */
+    0x003c  /* ..####.. */
 };
 static const CharacterImage pin_font_0x38 = { image_data_pin_font_0x38, 8, 12};
 
-static const uint8_t image_data_pin_font_0x39[96] =
-{
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff
+static const uint16_t image_data_pin_font_0x39[12] =
+{
+    0x003c, /* ..####.. */
+    0x007e, /* .######. */
+    0x00c3, /* ##....## */
+    0x00c3, /* ##....## */
+    0x00c3, /* ##....## */
+    0x00fe, /* .####### */
+    0x00fc, /* ..###### */
+    0x00c0, /* ......## */
+    0x00c0, /* ......## */
+    0x00c0, /* ......## */
+    0x007e, /* .######. */
+    0x003c  /* ..####.. */
 };
 static const CharacterImage pin_font_0x39 = { image_data_pin_font_0x39, 8, 12};
 
@@ -227,1433 +227,1460 @@ static const Character pin_font_array[] =
 
 };
 
+/* Direct-indexed by character code */
+static const CharacterImage *const pin_font_table[FONT_TABLE_SIZE] =
+{
+    [0x31] = &pin_font_0x31,
+    [0x32] = &pin_font_0x32,
+    [0x33] = &pin_font_0x33,
+    [0x34] = &pin_font_0x34,
+    [0x35] = &pin_font_0x35,
+    [0x36] = &pin_font_0x36,
+    [0x37] = &pin_font_0x37,
+    [0x38] = &pin_font_0x38,
+    [0x39] = &pin_font_0x39
+};
+
+static const uint8_t pin_font_widths[FONT_TABLE_SIZE] =
+{
+     9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+     9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+     9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+     9,  4,  8,  8,  8,  8,  8,  8,  8,  8,  9,  9,  9,  9,  9,  9,
+     9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+     9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+     9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+     9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9
+};
+
 static const Font pin_font = { sizeof(pin_font_array)/sizeof(pin_font_array[0]),
-                               14, pin_font_array };
+                               14, pin_font_array,
+                               pin_font_table, pin_font_widths };
 
 /* --- Title Font ---------------------------------------------------------- */
 
-static const uint8_t image_data_title_font_0x20[50] =
+static const uint16_t image_data_title_font_0x20[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ..... */
+    0x0000, /* ..... */
+    0x0000, /* ..... */
+    0x0000, /* ..... */
+    0x0000, /* ..... */
+    0x0000, /* ..... */
+    0x0000, /* ..... */
+    0x0000, /* ..... */
+    0x0000, /* ..... */
+    0x0000  /* ..... */
 };
 static const CharacterImage title_font_0x20 = { image_data_title_font_0x20, 5, 10};
 
-static const uint8_t image_data_title_font_0x21[30] =
+static const uint16_t image_data_title_font_0x21[10] =
 {
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
+    0x0000, /* ... */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0000, /* ... */
+    0x0003, /* ##. */
+    0x0000, /* ... */
+    0x0000  /* ... */
 };
 static const CharacterImage title_font_0x21 = { image_data_title_font_0x21, 3, 10};
 
-static const uint8_t image_data_title_font_0x22[50] =
+static const uint16_t image_data_title_font_0x22[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ..... */
+    0x000f, /* ####. */
+    0x000f, /* ####. */
+    0x0000, /* ..... */
+    0x0000, /* ..... */
+    0x0000, /* ..... */
+    0x0000, /* ..... */
+    0x0000, /* ..... */
+    0x0000, /* ..... */
+    0x0000  /* ..... */
 };
 static const CharacterImage title_font_0x22 = { image_data_title_font_0x22, 5, 10};
 
-static const uint8_t image_data_title_font_0x23[80] =
+static const uint16_t image_data_title_font_0x23[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ........ */
+    0x0036, /* .##.##.. */
+    0x007f, /* #######. */
+    0x0036, /* .##.##.. */
+    0x0036, /* .##.##.. */
+    0x007f, /* #######. */
+    0x0036, /* .##.##.. */
+    0x0000, /* ........ */
+    0x0000, /* ........ */
+    0x0000  /* ........ */
 };
 static const CharacterImage title_font_0x23 = { image_data_title_font_0x23, 8, 10};
 
-static const uint8_t image_data_title_font_0x24[70] =
+static const uint16_t image_data_title_font_0x24[10] =
 {
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x000c, /* ..##... */
+    0x003e, /* .#####. */
+    0x000f, /* ####... */
+    0x000f, /* ####... */
+    0x001e, /* .####.. */
+    0x003c, /* ..####. */
+    0x003c, /* ..####. */
+    0x001f, /* #####.. */
+    0x000c, /* ..##... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x24 = { image_data_title_font_0x24, 7, 10};
 
-static const uint8_t image_data_title_font_0x25[90] =
+static const uint16_t image_data_title_font_0x25[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ......... */
+    0x00c6, /* .##...##. */
+    0x006f, /* ####.##.. */
+    0x0036, /* .##.##... */
+    0x0018, /* ...##.... */
+    0x006c, /* ..##.##.. */
+    0x00f6, /* .##.####. */
+    0x0063, /* ##...##.. */
+    0x0000, /* ......... */
+    0x0000  /* ......... */
 };
 static const CharacterImage title_font_0x25 = { image_data_title_font_0x25, 9, 10};
 
-static const uint8_t image_data_title_font_0x26[80] =
+static const uint16_t image_data_title_font_0x26[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ........ */
+    0x000e, /* .###.... */
+    0x001b, /* ##.##... */
+    0x001b, /* ##.##... */
+    0x000e, /* .###.... */
+    0x007b, /* ##.####. */
+    0x0033, /* ##..##.. */
+    0x007e, /* .######. */
+    0x0000, /* ........ */
+    0x0000  /* ........ */
 };
 static const CharacterImage title_font_0x26 = { image_data_title_font_0x26, 8, 10};
 
-static const uint8_t image_data_title_font_0x27[30] =
+static const uint16_t image_data_title_font_0x27[10] =
 {
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
+    0x0000, /* ... */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0000, /* ... */
+    0x0000, /* ... */
+    0x0000, /* ... */
+    0x0000, /* ... */
+    0x0000, /* ... */
+    0x0000, /* ... */
+    0x0000  /* ... */
 };
 static const CharacterImage title_font_0x27 = { image_data_title_font_0x27, 3, 10};
 
-static const uint8_t image_data_title_font_0x28[40] =
+static const uint16_t image_data_title_font_0x28[10] =
 {
-    0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff
+    0x0006, /* .##. */
+    0x0003, /* ##.. */
+    0x0003, /* ##.. */
+    0x0003, /* ##.. */
+    0x0003, /* ##.. */
+    0x0003, /* ##.. */
+    0x0003, /* ##.. */
+    0x0003, /* ##.. */
+    0x0006, /* .##. */
+    0x0000  /* .... */
 };
 static const CharacterImage title_font_0x28 = { image_data_title_font_0x28, 4, 10};
 
-static const uint8_t image_data_title_font_0x29[40] =
+static const uint16_t image_data_title_font_0x29[10] =
 {
-    0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
+    0x0003, /* ##.. */
+    0x0006, /* .##. */
+    0x0006, /* .##. */
+    0x0006, /* .##. */
+    0x0006, /* .##. */
+    0x0006, /* .##. */
+    0x0006, /* .##. */
+    0x0006, /* .##. */
+    0x0003, /* ##.. */
+    0x0000  /* .... */
 };
 static const CharacterImage title_font_0x29 = { image_data_title_font_0x29, 4, 10};
 
-static const uint8_t image_data_title_font_0x2a[70] =
+static const uint16_t image_data_title_font_0x2a[10] =
 {
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x000c, /* ..##... */
+    0x003f, /* ######. */
+    0x001e, /* .####.. */
+    0x003f, /* ######. */
+    0x000c, /* ..##... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x2a = { image_data_title_font_0x2a, 7, 10};
 
-static const uint8_t image_data_title_font_0x2b[70] =
+static const uint16_t image_data_title_font_0x2b[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x000c, /* ..##... */
+    0x000c, /* ..##... */
+    0x003f, /* ######. */
+    0x000c, /* ..##... */
+    0x000c, /* ..##... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x2b = { image_data_title_font_0x2b, 7, 10};
 
-static const uint8_t image_data_title_font_0x2c[40] =
+static const uint16_t image_data_title_font_0x2c[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0007, /* ###. */
+    0x0007, /* ###. */
+    0x0006, /* .##. */
+    0x0003  /* ##.. */
 };
 static const CharacterImage title_font_0x2c = { image_data_title_font_0x2c, 4, 10};
 
-static const uint8_t image_data_title_font_0x2d[70] =
+static const uint16_t image_data_title_font_0x2d[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x003f, /* ######. */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x2d = { image_data_title_font_0x2d, 7, 10};
 
-static const uint8_t image_data_title_font_0x2e[40] =
+static const uint16_t image_data_title_font_0x2e[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0007, /* ###. */
+    0x0007, /* ###. */
+    0x0000, /* .... */
+    0x0000  /* .... */
 };
 static const CharacterImage title_font_0x2e = { image_data_title_font_0x2e, 4, 10};
 
-static const uint8_t image_data_title_font_0x2f[90] =
+static const uint16_t image_data_title_font_0x2f[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ......... */
+    0x00c0, /* ......##. */
+    0x0060, /* .....##.. */
+    0x0030, /* ....##... */
+    0x0018, /* ...##.... */
+    0x000c, /* ..##..... */
+    0x0006, /* .##...... */
+    0x0003, /* ##....... */
+    0x0000, /* ......... */
+    0x0000  /* ......... */
 };
 static const CharacterImage title_font_0x2f = { image_data_title_font_0x2f, 9, 10};
 
-static const uint8_t image_data_title_font_0x30[70] =
+static const uint16_t image_data_title_font_0x30[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x001e, /* .####.. */
+    0x0033, /* ##..##. */
+    0x003b, /* ##.###. */
+    0x003f, /* ######. */
+    0x0037, /* ###.##. */
+    0x0033, /* ##..##. */
+    0x001e, /* .####.. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x30 = { image_data_title_font_0x30, 7, 10};
 
-static const uint8_t image_data_title_font_0x31[40] =
+static const uint16_t image_data_title_font_0x31[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
+    0x0000, /* .... */
+    0x0007, /* ###. */
+    0x0006, /* .##. */
+    0x0006, /* .##. */
+    0x0006, /* .##. */
+    0x0006, /* .##. */
+    0x0006, /* .##. */
+    0x0006, /* .##. */
+    0x0000, /* .... */
+    0x0000  /* .... */
 };
 static const CharacterImage title_font_0x31 = { image_data_title_font_0x31, 4, 10};
 
-static const uint8_t image_data_title_font_0x32[70] =
+static const uint16_t image_data_title_font_0x32[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x001f, /* #####.. */
+    0x0030, /* ....##. */
+    0x0030, /* ....##. */
+    0x001e, /* .####.. */
+    0x0003, /* ##..... */
+    0x0003, /* ##..... */
+    0x003f, /* ######. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x32 = { image_data_title_font_0x32, 7, 10};
 
-static const uint8_t image_data_title_font_0x33[70] =
+static const uint16_t image_data_title_font_0x33[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x001f, /* #####.. */
+    0x0030, /* ....##. */
+    0x0030, /* ....##. */
+    0x001e, /* .####.. */
+    0x0030, /* ....##. */
+    0x0030, /* ....##. */
+    0x001f, /* #####.. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x33 = { image_data_title_font_0x33, 7, 10};
 
-static const uint8_t image_data_title_font_0x34[70] =
+static const uint16_t image_data_title_font_0x34[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0018, /* ...##.. */
+    0x001c, /* ..###.. */
+    0x001e, /* .####.. */
+    0x001b, /* ##.##.. */
+    0x003f, /* ######. */
+    0x0018, /* ...##.. */
+    0x0018, /* ...##.. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x34 = { image_data_title_font_0x34, 7, 10};
 
-static const uint8_t image_data_title_font_0x35[70] =
+static const uint16_t image_data_title_font_0x35[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x003f, /* ######. */
+    0x0003, /* ##..... */
+    0x0003, /* ##..... */
+    0x001f, /* #####.. */
+    0x0030, /* ....##. */
+    0x0030, /* ....##. */
+    0x001f, /* #####.. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x35 = { image_data_title_font_0x35, 7, 10};
 
-static const uint8_t image_data_title_font_0x36[70] =
+static const uint16_t image_data_title_font_0x36[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x001e, /* .####.. */
+    0x0003, /* ##..... */
+    0x0003, /* ##..... */
+    0x001f, /* #####.. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x001e, /* .####.. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x36 = { image_data_title_font_0x36, 7, 10};
 
-static const uint8_t image_data_title_font_0x37[70] =
+static const uint16_t image_data_title_font_0x37[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x003f, /* ######. */
+    0x0030, /* ....##. */
+    0x0018, /* ...##.. */
+    0x0018, /* ...##.. */
+    0x000c, /* ..##... */
+    0x000c, /* ..##... */
+    0x0006, /* .##.... */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x37 = { image_data_title_font_0x37, 7, 10};
 
-static const uint8_t image_data_title_font_0x38[70] =
+static const uint16_t image_data_title_font_0x38[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x001e, /* .####.. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x001e, /* .####.. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x001e, /* .####.. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x38 = { image_data_title_font_0x38, 7, 10};
 
-static const uint8_t image_data_title_font_0x39[70] =
+static const uint16_t image_data_title_font_0x39[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x001e, /* .####.. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x003e, /* .#####. */
+    0x0030, /* ....##. */
+    0x0030, /* ....##. */
+    0x001e, /* .####.. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x39 = { image_data_title_font_0x39, 7, 10};
 
-static const uint8_t image_data_title_font_0x3a[40] =
+static const uint16_t image_data_title_font_0x3a[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0007, /* ###. */
+    0x0007, /* ###. */
+    0x0000, /* .... */
+    0x0007, /* ###. */
+    0x0007, /* ###. */
+    0x0000, /* .... */
+    0x0000  /* .... */
 };
 static const CharacterImage title_font_0x3a = { image_data_title_font_0x3a, 4, 10};
 
-static const uint8_t image_data_title_font_0x3b[40] =
+static const uint16_t image_data_title_font_0x3b[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0007, /* ###. */
+    0x0007, /* ###. */
+    0x0000, /* .... */
+    0x0007, /* ###. */
+    0x0007, /* ###. */
+    0x0006, /* .##. */
+    0x0003  /* ##.. */
 };
 static const CharacterImage title_font_0x3b = { image_data_title_font_0x3b, 4, 10};
 
-static const uint8_t image_data_title_font_0x3c[60] =
+static const uint16_t image_data_title_font_0x3c[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0018, /* ...##. */
+    0x000c, /* ..##.. */
+    0x0006, /* .##... */
+    0x0003, /* ##.... */
+    0x0006, /* .##... */
+    0x000c, /* ..##.. */
+    0x0018, /* ...##. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage title_font_0x3c = { image_data_title_font_0x3c, 6, 10};
 
-static const uint8_t image_data_title_font_0x3d[70] =
+static const uint16_t image_data_title_font_0x3d[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x003f, /* ######. */
+    0x0000, /* ....... */
+    0x003f, /* ######. */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x3d = { image_data_title_font_0x3d, 7, 10};
 
-static const uint8_t image_data_title_font_0x3e[60] =
+static const uint16_t image_data_title_font_0x3e[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0003, /* ##.... */
+    0x0006, /* .##... */
+    0x000c, /* ..##.. */
+    0x0018, /* ...##. */
+    0x000c, /* ..##.. */
+    0x0006, /* .##... */
+    0x0003, /* ##.... */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage title_font_0x3e = { image_data_title_font_0x3e, 6, 10};
 
-static const uint8_t image_data_title_font_0x3f[70] =
+static const uint16_t image_data_title_font_0x3f[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x001e, /* .####.. */
+    0x0033, /* ##..##. */
+    0x0030, /* ....##. */
+    0x0018, /* ...##.. */
+    0x000c, /* ..##... */
+    0x0000, /* ....... */
+    0x000c, /* ..##... */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x3f = { image_data_title_font_0x3f, 7, 10};
 
-static const uint8_t image_data_title_font_0x40[90] =
+static const uint16_t image_data_title_font_0x40[10] =
 {
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x007c, /* ..#####.. */
+    0x00c6, /* .##...##. */
+    0x01bb, /* ##.###.## */
+    0x01e3, /* ##...#### */
+    0x01fb, /* ##.###### */
+    0x01ef, /* ####.#### */
+    0x00fb, /* ##.#####. */
+    0x0006, /* .##...... */
+    0x007c, /* ..#####.. */
+    0x0000  /* ......... */
 };
 static const CharacterImage title_font_0x40 = { image_data_title_font_0x40, 9, 10};
 
-static const uint8_t image_data_title_font_0x41[70] =
+static const uint16_t image_data_title_font_0x41[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x001e, /* .####.. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x003f, /* ######. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x41 = { image_data_title_font_0x41, 7, 10};
 
-static const uint8_t image_data_title_font_0x42[70] =
+static const uint16_t image_data_title_font_0x42[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x001f, /* #####.. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x001f, /* #####.. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x001f, /* #####.. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x42 = { image_data_title_font_0x42, 7, 10};
 
-static const uint8_t image_data_title_font_0x43[70] =
+static const uint16_t image_data_title_font_0x43[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x001e, /* .####.. */
+    0x0033, /* ##..##. */
+    0x0003, /* ##..... */
+    0x0003, /* ##..... */
+    0x0003, /* ##..... */
+    0x0033, /* ##..##. */
+    0x001e, /* .####.. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x43 = { image_data_title_font_0x43, 7, 10};
 
-static const uint8_t image_data_title_font_0x44[70] =
+static const uint16_t image_data_title_font_0x44[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x001f, /* #####.. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x001f, /* #####.. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x44 = { image_data_title_font_0x44, 7, 10};
 
-static const uint8_t image_data_title_font_0x45[70] =
+static const uint16_t image_data_title_font_0x45[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x003f, /* ######. */
+    0x0003, /* ##..... */
+    0x0003, /* ##..... */
+    0x001f, /* #####.. */
+    0x0003, /* ##..... */
+    0x0003, /* ##..... */
+    0x003f, /* ######. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x45 = { image_data_title_font_0x45, 7, 10};
 
-static const uint8_t image_data_title_font_0x46[70] =
+static const uint16_t image_data_title_font_0x46[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x003f, /* ######. */
+    0x0003, /* ##..... */
+    0x0003, /* ##..... */
+    0x001f, /* #####.. */
+    0x0003, /* ##..... */
+    0x0003, /* ##..... */
+    0x0003, /* ##..... */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x46 = { image_data_title_font_0x46, 7, 10};
 
-static const uint8_t image_data_title_font_0x47[70] =
+static const uint16_t image_data_title_font_0x47[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x001e, /* .####.. */
+    0x0033, /* ##..##. */
+    0x0003, /* ##..... */
+    0x003b, /* ##.###. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x003e, /* .#####. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x47 = { image_data_title_font_0x47, 7, 10};
 
-static const uint8_t image_data_title_font_0x48[70] =
+static const uint16_t image_data_title_font_0x48[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x003f, /* ######. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x48 = { image_data_title_font_0x48, 7, 10};
 
-static const uint8_t image_data_title_font_0x49[50] =
+static const uint16_t image_data_title_font_0x49[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ..... */
+    0x000f, /* ####. */
+    0x0006, /* .##.. */
+    0x0006, /* .##.. */
+    0x0006, /* .##.. */
+    0x0006, /* .##.. */
+    0x0006, /* .##.. */
+    0x000f, /* ####. */
+    0x0000, /* ..... */
+    0x0000  /* ..... */
 };
 static const CharacterImage title_font_0x49 = { image_data_title_font_0x49, 5, 10};
 
-static const uint8_t image_data_title_font_0x4a[70] =
+static const uint16_t image_data_title_font_0x4a[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0030, /* ....##. */
+    0x0030, /* ....##. */
+    0x0030, /* ....##. */
+    0x0030, /* ....##. */
+    0x0030, /* ....##. */
+    0x0033, /* ##..##. */
+    0x001e, /* .####.. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x4a = { image_data_title_font_0x4a, 7, 10};
 
-static const uint8_t image_data_title_font_0x4b[70] =
+static const uint16_t image_data_title_font_0x4b[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0033, /* ##..##. */
+    0x001b, /* ##.##.. */
+    0x000f, /* ####... */
+    0x0007, /* ###.... */
+    0x000f, /* ####... */
+    0x001b, /* ##.##.. */
+    0x0033, /* ##..##. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x4b = { image_data_title_font_0x4b, 7, 10};
 
-static const uint8_t image_data_title_font_0x4c[70] =
+static const uint16_t image_data_title_font_0x4c[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0003, /* ##..... */
+    0x0003, /* ##..... */
+    0x0003, /* ##..... */
+    0x0003, /* ##..... */
+    0x0003, /* ##..... */
+    0x0003, /* ##..... */
+    0x003f, /* ######. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x4c = { image_data_title_font_0x4c, 7, 10};
 
-static const uint8_t image_data_title_font_0x4d[90] =
+static const uint16_t image_data_title_font_0x4d[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ......... */
+    0x00c3, /* ##....##. */
+    0x00e7, /* ###..###. */
+    0x00ff, /* ########. */
+    0x00db, /* ##.##.##. */
+    0x00c3, /* ##....##. */
+    0x00c3, /* ##....##. */
+    0x00c3, /* ##....##. */
+    0x0000, /* ......... */
+    0x0000  /* ......... */
 };
 static const CharacterImage title_font_0x4d = { image_data_title_font_0x4d, 9, 10};
 
-static const uint8_t image_data_title_font_0x4e[70] =
+static const uint16_t image_data_title_font_0x4e[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0037, /* ###.##. */
+    0x003f, /* ######. */
+    0x003b, /* ##.###. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x4e = { image_data_title_font_0x4e, 7, 10};
 
-static const uint8_t image_data_title_font_0x4f[70] =
+static const uint16_t image_data_title_font_0x4f[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x001e, /* .####.. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x001e, /* .####.. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x4f = { image_data_title_font_0x4f, 7, 10};
 
-static const uint8_t image_data_title_font_0x50[70] =
+static const uint16_t image_data_title_font_0x50[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x001f, /* #####.. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x001f, /* #####.. */
+    0x0003, /* ##..... */
+    0x0003, /* ##..... */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x50 = { image_data_title_font_0x50, 7, 10};
 
-static const uint8_t image_data_title_font_0x51[70] =
+static const uint16_t image_data_title_font_0x51[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x001e, /* .####.. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x001e, /* .####.. */
+    0x0030, /* ....##. */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x51 = { image_data_title_font_0x51, 7, 10};
 
-static const uint8_t image_data_title_font_0x52[70] =
+static const uint16_t image_data_title_font_0x52[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x001f, /* #####.. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x001f, /* #####.. */
+    0x001b, /* ##.##.. */
+    0x0033, /* ##..##. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x52 = { image_data_title_font_0x52, 7, 10};
 
-static const uint8_t image_data_title_font_0x53[70] =
+static const uint16_t image_data_title_font_0x53[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x001e, /* .####.. */
+    0x0033, /* ##..##. */
+    0x0003, /* ##..... */
+    0x001e, /* .####.. */
+    0x0030, /* ....##. */
+    0x0033, /* ##..##. */
+    0x001e, /* .####.. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x53 = { image_data_title_font_0x53, 7, 10};
 
-static const uint8_t image_data_title_font_0x54[70] =
+static const uint16_t image_data_title_font_0x54[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x003f, /* ######. */
+    0x000c, /* ..##... */
+    0x000c, /* ..##... */
+    0x000c, /* ..##... */
+    0x000c, /* ..##... */
+    0x000c, /* ..##... */
+    0x000c, /* ..##... */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x54 = { image_data_title_font_0x54, 7, 10};
 
-static const uint8_t image_data_title_font_0x55[70] =
+static const uint16_t image_data_title_font_0x55[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x001e, /* .####.. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x55 = { image_data_title_font_0x55, 7, 10};
 
-static const uint8_t image_data_title_font_0x56[70] =
+static const uint16_t image_data_title_font_0x56[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x001e, /* .####.. */
+    0x001e, /* .####.. */
+    0x000c, /* ..##... */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x56 = { image_data_title_font_0x56, 7, 10};
 
-static const uint8_t image_data_title_font_0x57[90] =
+static const uint16_t image_data_title_font_0x57[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ......... */
+    0x00db, /* ##.##.##. */
+    0x00db, /* ##.##.##. */
+    0x00db, /* ##.##.##. */
+    0x00db, /* ##.##.##. */
+    0x00db, /* ##.##.##. */
+    0x00db, /* ##.##.##. */
+    0x007e, /* .######.. */
+    0x0000, /* ......... */
+    0x0000  /* ......... */
 };
 static const CharacterImage title_font_0x57 = { image_data_title_font_0x57, 9, 10};
 
-static const uint8_t image_data_title_font_0x58[70] =
+static const uint16_t image_data_title_font_0x58[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x001e, /* .####.. */
+    0x000c, /* ..##... */
+    0x001e, /* .####.. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x58 = { image_data_title_font_0x58, 7, 10};
 
-static const uint8_t image_data_title_font_0x59[70] =
+static const uint16_t image_data_title_font_0x59[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x001e, /* .####.. */
+    0x000c, /* ..##... */
+    0x000c, /* ..##... */
+    0x000c, /* ..##... */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x59 = { image_data_title_font_0x59, 7, 10};
 
-static const uint8_t image_data_title_font_0x5a[70] =
+static const uint16_t image_data_title_font_0x5a[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x003f, /* ######. */
+    0x0030, /* ....##. */
+    0x0018, /* ...##.. */
+    0x000c, /* ..##... */
+    0x0006, /* .##.... */
+    0x0003, /* ##..... */
+    0x003f, /* ######. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x5a = { image_data_title_font_0x5a, 7, 10};
 
-static const uint8_t image_data_title_font_0x5b[50] =
+static const uint16_t image_data_title_font_0x5b[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ..... */
+    0x000f, /* ####. */
+    0x0003, /* ##... */
+    0x0003, /* ##... */
+    0x0003, /* ##... */
+    0x0003, /* ##... */
+    0x0003, /* ##... */
+    0x000f, /* ####. */
+    0x0000, /* ..... */
+    0x0000  /* ..... */
 };
 static const CharacterImage title_font_0x5b = { image_data_title_font_0x5b, 5, 10};
 
-static const uint8_t image_data_title_font_0x5c[90] =
+static const uint16_t image_data_title_font_0x5c[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ......... */
+    0x0003, /* ##....... */
+    0x0006, /* .##...... */
+    0x000c, /* ..##..... */
+    0x0018, /* ...##.... */
+    0x0030, /* ....##... */
+    0x0060, /* .....##.. */
+    0x00c0, /* ......##. */
+    0x0000, /* ......... */
+    0x0000  /* ......... */
 };
 static const CharacterImage title_font_0x5c = { image_data_title_font_0x5c, 9, 10};
 
-static const uint8_t image_data_title_font_0x5d[50] =
+static const uint16_t image_data_title_font_0x5d[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ..... */
+    0x000f, /* ####. */
+    0x000c, /* ..##. */
+    0x000c, /* ..##. */
+    0x000c, /* ..##. */
+    0x000c, /* ..##. */
+    0x000c, /* ..##. */
+    0x000f, /* ####. */
+    0x0000, /* ..... */
+    0x0000  /* ..... */
 };
 static const CharacterImage title_font_0x5d = { image_data_title_font_0x5d, 5, 10};
 
-static const uint8_t image_data_title_font_0x5e[50] =
+static const uint16_t image_data_title_font_0x5e[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ..... */
+    0x0006, /* .##.. */
+    0x000f, /* ####. */
+    0x0000, /* ..... */
+    0x0000, /* ..... */
+    0x0000, /* ..... */
+    0x0000, /* ..... */
+    0x0000, /* ..... */
+    0x0000, /* ..... */
+    0x0000  /* ..... */
 };
 static const CharacterImage title_font_0x5e = { image_data_title_font_0x5e, 5, 10};
 
-static const uint8_t image_data_title_font_0x5f[70] =
+static const uint16_t image_data_title_font_0x5f[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x003f, /* ######. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x5f = { image_data_title_font_0x5f, 7, 10};
 
-static const uint8_t image_data_title_font_0x60[40] =
+static const uint16_t image_data_title_font_0x60[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
+    0x0000, /* .... */
+    0x0003, /* ##.. */
+    0x0006, /* .##. */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000  /* .... */
 };
 static const CharacterImage title_font_0x60 = { image_data_title_font_0x60, 4, 10};
 
-static const uint8_t image_data_title_font_0x61[70] =
+static const uint16_t image_data_title_font_0x61[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x001e, /* .####.. */
+    0x0030, /* ....##. */
+    0x003e, /* .#####. */
+    0x0033, /* ##..##. */
+    0x003e, /* .#####. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x61 = { image_data_title_font_0x61, 7, 10};
 
-static const uint8_t image_data_title_font_0x62[70] =
+static const uint16_t image_data_title_font_0x62[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0003, /* ##..... */
+    0x0003, /* ##..... */
+    0x001f, /* #####.. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x001f, /* #####.. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x62 = { image_data_title_font_0x62, 7, 10};
 
-static const uint8_t image_data_title_font_0x63[70] =
+static const uint16_t image_data_title_font_0x63[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x003e, /* .#####. */
+    0x0003, /* ##..... */
+    0x0003, /* ##..... */
+    0x0003, /* ##..... */
+    0x003e, /* .#####. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x63 = { image_data_title_font_0x63, 7, 10};
 
-static const uint8_t image_data_title_font_0x64[70] =
+static const uint16_t image_data_title_font_0x64[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0030, /* ....##. */
+    0x0030, /* ....##. */
+    0x003e, /* .#####. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x003e, /* .#####. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x64 = { image_data_title_font_0x64, 7, 10};
 
-static const uint8_t image_data_title_font_0x65[70] =
+static const uint16_t image_data_title_font_0x65[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x001e, /* .####.. */
+    0x0033, /* ##..##. */
+    0x003f, /* ######. */
+    0x0003, /* ##..... */
+    0x003e, /* .#####. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x65 = { image_data_title_font_0x65, 7, 10};
 
-static const uint8_t image_data_title_font_0x66[60] =
+static const uint16_t image_data_title_font_0x66[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x001c, /* ..###. */
+    0x0006, /* .##... */
+    0x001f, /* #####. */
+    0x0006, /* .##... */
+    0x0006, /* .##... */
+    0x0006, /* .##... */
+    0x0006, /* .##... */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage title_font_0x66 = { image_data_title_font_0x66, 6, 10};
 
-static const uint8_t image_data_title_font_0x67[70] =
+static const uint16_t image_data_title_font_0x67[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x003e, /* .#####. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x003e, /* .#####. */
+    0x0030, /* ....##. */
+    0x001e  /* .####.. */
 };
 static const CharacterImage title_font_0x67 = { image_data_title_font_0x67, 7, 10};
 
-static const uint8_t image_data_title_font_0x68[70] =
+static const uint16_t image_data_title_font_0x68[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0003, /* ##..... */
+    0x0003, /* ##..... */
+    0x001f, /* #####.. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x68 = { image_data_title_font_0x68, 7, 10};
 
-static const uint8_t image_data_title_font_0x69[30] =
+static const uint16_t image_data_title_font_0x69[10] =
 {
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
+    0x0000, /* ... */
+    0x0003, /* ##. */
+    0x0000, /* ... */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0000, /* ... */
+    0x0000  /* ... */
 };
 static const CharacterImage title_font_0x69 = { image_data_title_font_0x69, 3, 10};
 
-static const uint8_t image_data_title_font_0x6a[40] =
+static const uint16_t image_data_title_font_0x6a[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff
+    0x0000, /* .... */
+    0x0006, /* .##. */
+    0x0000, /* .... */
+    0x0006, /* .##. */
+    0x0006, /* .##. */
+    0x0006, /* .##. */
+    0x0006, /* .##. */
+    0x0006, /* .##. */
+    0x0006, /* .##. */
+    0x0003  /* ##.. */
 };
 static const CharacterImage title_font_0x6a = { image_data_title_font_0x6a, 4, 10};
 
-static const uint8_t image_data_title_font_0x6b[60] =
+static const uint16_t image_data_title_font_0x6b[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0003, /* ##.... */
+    0x0003, /* ##.... */
+    0x001b, /* ##.##. */
+    0x000f, /* ####.. */
+    0x0007, /* ###... */
+    0x000f, /* ####.. */
+    0x001b, /* ##.##. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage title_font_0x6b = { image_data_title_font_0x6b, 6, 10};
 
-static const uint8_t image_data_title_font_0x6c[30] =
+static const uint16_t image_data_title_font_0x6c[10] =
 {
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
+    0x0000, /* ... */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0000, /* ... */
+    0x0000  /* ... */
 };
 static const CharacterImage title_font_0x6c = { image_data_title_font_0x6c, 3, 10};
 
-static const uint8_t image_data_title_font_0x6d[90] =
+static const uint16_t image_data_title_font_0x6d[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ......... */
+    0x0000, /* ......... */
+    0x0000, /* ......... */
+    0x007f, /* #######.. */
+    0x00db, /* ##.##.##. */
+    0x00db, /* ##.##.##. */
+    0x00db, /* ##.##.##. */
+    0x00db, /* ##.##.##. */
+    0x0000, /* ......... */
+    0x0000  /* ......... */
 };
 static const CharacterImage title_font_0x6d = { image_data_title_font_0x6d, 9, 10};
 
-static const uint8_t image_data_title_font_0x6e[70] =
+static const uint16_t image_data_title_font_0x6e[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x001f, /* #####.. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x6e = { image_data_title_font_0x6e, 7, 10};
 
-static const uint8_t image_data_title_font_0x6f[70] =
+static const uint16_t image_data_title_font_0x6f[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x001e, /* .####.. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x001e, /* .####.. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x6f = { image_data_title_font_0x6f, 7, 10};
 
-static const uint8_t image_data_title_font_0x70[70] =
+static const uint16_t image_data_title_font_0x70[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x001f, /* #####.. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x001f, /* #####.. */
+    0x0003, /* ##..... */
+    0x0003  /* ##..... */
 };
 static const CharacterImage title_font_0x70 = { image_data_title_font_0x70, 7, 10};
 
-static const uint8_t image_data_title_font_0x71[70] =
+static const uint16_t image_data_title_font_0x71[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x003e, /* .#####. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x003e, /* .#####. */
+    0x0030, /* ....##. */
+    0x0030  /* ....##. */
 };
 static const CharacterImage title_font_0x71 = { image_data_title_font_0x71, 7, 10};
 
-static const uint8_t image_data_title_font_0x72[60] =
+static const uint16_t image_data_title_font_0x72[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x001f, /* #####. */
+    0x0007, /* ###... */
+    0x0003, /* ##.... */
+    0x0003, /* ##.... */
+    0x0003, /* ##.... */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage title_font_0x72 = { image_data_title_font_0x72, 6, 10};
 
-static const uint8_t image_data_title_font_0x73[70] =
+static const uint16_t image_data_title_font_0x73[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x003e, /* .#####. */
+    0x0003, /* ##..... */
+    0x001e, /* .####.. */
+    0x0030, /* ....##. */
+    0x001f, /* #####.. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x73 = { image_data_title_font_0x73, 7, 10};
 
-static const uint8_t image_data_title_font_0x74[60] =
+static const uint16_t image_data_title_font_0x74[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0006, /* .##... */
+    0x0006, /* .##... */
+    0x001f, /* #####. */
+    0x0006, /* .##... */
+    0x0006, /* .##... */
+    0x0006, /* .##... */
+    0x001c, /* ..###. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage title_font_0x74 = { image_data_title_font_0x74, 6, 10};
 
-static const uint8_t image_data_title_font_0x75[70] =
+static const uint16_t image_data_title_font_0x75[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x003e, /* .#####. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x75 = { image_data_title_font_0x75, 7, 10};
 
-static const uint8_t image_data_title_font_0x76[70] =
+static const uint16_t image_data_title_font_0x76[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x001e, /* .####.. */
+    0x001e, /* .####.. */
+    0x000c, /* ..##... */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x76 = { image_data_title_font_0x76, 7, 10};
 
-static const uint8_t image_data_title_font_0x77[90] =
+static const uint16_t image_data_title_font_0x77[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ......... */
+    0x0000, /* ......... */
+    0x0000, /* ......... */
+    0x00db, /* ##.##.##. */
+    0x00db, /* ##.##.##. */
+    0x00db, /* ##.##.##. */
+    0x00db, /* ##.##.##. */
+    0x007e, /* .######.. */
+    0x0000, /* ......... */
+    0x0000  /* ......... */
 };
 static const CharacterImage title_font_0x77 = { image_data_title_font_0x77, 9, 10};
 
-static const uint8_t image_data_title_font_0x78[70] =
+static const uint16_t image_data_title_font_0x78[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0033, /* ##..##. */
+    0x001e, /* .####.. */
+    0x000c, /* ..##... */
+    0x001e, /* .####.. */
+    0x0033, /* ##..##. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x78 = { image_data_title_font_0x78, 7, 10};
 
-static const uint8_t image_data_title_font_0x79[70] =
+static const uint16_t image_data_title_font_0x79[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x0033, /* ##..##. */
+    0x003e, /* .#####. */
+    0x0030, /* ....##. */
+    0x001e  /* .####.. */
 };
 static const CharacterImage title_font_0x79 = { image_data_title_font_0x79, 7, 10};
 
-static const uint8_t image_data_title_font_0x7a[70] =
+static const uint16_t image_data_title_font_0x7a[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x003f, /* ######. */
+    0x0018, /* ...##.. */
+    0x000c, /* ..##... */
+    0x0006, /* .##.... */
+    0x003f, /* ######. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x7a = { image_data_title_font_0x7a, 7, 10};
 
-static const uint8_t image_data_title_font_0x7b[60] =
+static const uint16_t image_data_title_font_0x7b[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x001c, /* ..###. */
+    0x0006, /* .##... */
+    0x0006, /* .##... */
+    0x0003, /* ##.... */
+    0x0006, /* .##... */
+    0x0006, /* .##... */
+    0x001c, /* ..###. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage title_font_0x7b = { image_data_title_font_0x7b, 6, 10};
 
-static const uint8_t image_data_title_font_0x7c[30] =
+static const uint16_t image_data_title_font_0x7c[10] =
 {
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
+    0x0000, /* ... */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0000, /* ... */
+    0x0000  /* ... */
 };
 static const CharacterImage title_font_0x7c = { image_data_title_font_0x7c, 3, 10};
 
-static const uint8_t image_data_title_font_0x7d[60] =
+static const uint16_t image_data_title_font_0x7d[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0007, /* ###... */
+    0x000c, /* ..##.. */
+    0x000c, /* ..##.. */
+    0x0018, /* ...##. */
+    0x000c, /* ..##.. */
+    0x000c, /* ..##.. */
+    0x0007, /* ###... */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage title_font_0x7d = { image_data_title_font_0x7d, 6, 10};
 
-static const uint8_t image_data_title_font_0x7e[70] =
+static const uint16_t image_data_title_font_0x7e[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x003e, /* .#####. */
+    0x001f, /* #####.. */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage title_font_0x7e = { image_data_title_font_0x7e, 7, 10};
 
@@ -1948,1433 +1975,1546 @@ static const Character title_font_array[] =
 
 };
 
+/* Direct-indexed by character code */
+static const CharacterImage *const title_font_table[FONT_TABLE_SIZE] =
+{
+    [0x20] = &title_font_0x20,
+    [0x21] = &title_font_0x21,
+    [0x22] = &title_font_0x22,
+    [0x23] = &title_font_0x23,
+    [0x24] = &title_font_0x24,
+    [0x25] = &title_font_0x25,
+    [0x26] = &title_font_0x26,
+    [0x27] = &title_font_0x27,
+    [0x28] = &title_font_0x28,
+    [0x29] = &title_font_0x29,
+    [0x2a] = &title_font_0x2a,
+    [0x2b] = &title_font_0x2b,
+    [0x2c] = &title_font_0x2c,
+    [0x2d] = &title_font_0x2d,
+    [0x2e] = &title_font_0x2e,
+    [0x2f] = &title_font_0x2f,
+    [0x30] = &title_font_0x30,
+    [0x31] = &title_font_0x31,
+    [0x32] = &title_font_0x32,
+    [0x33] = &title_font_0x33,
+    [0x34] = &title_font_0x34,
+    [0x35] = &title_font_0x35,
+    [0x36] = &title_font_0x36,
+    [0x37] = &title_font_0x37,
+    [0x38] = &title_font_0x38,
+    [0x39] = &title_font_0x39,
+    [0x3a] = &title_font_0x3a,
+    [0x3b] = &title_font_0x3b,
+    [0x3c] = &title_font_0x3c,
+    [0x3d] = &title_font_0x3d,
+    [0x3e] = &title_font_0x3e,
+    [0x3f] = &title_font_0x3f,
+    [0x40] = &title_font_0x40,
+    [0x41] = &title_font_0x41,
+    [0x42] = &title_font_0x42,
+    [0x43] = &title_font_0x43,
+    [0x44] = &title_font_0x44,
+    [0x45] = &title_font_0x45,
+    [0x46] = &title_font_0x46,
+    [0x47] = &title_font_0x47,
+    [0x48] = &title_font_0x48,
+    [0x49] = &title_font_0x49,
+    [0x4a] = &title_font_0x4a,
+    [0x4b] = &title_font_0x4b,
+    [0x4c] = &title_font_0x4c,
+    [0x4d] = &title_font_0x4d,
+    [0x4e] = &title_font_0x4e,
+    [0x4f] = &title_font_0x4f,
+    [0x50] = &title_font_0x50,
+    [0x51] = &title_font_0x51,
+    [0x52] = &title_font_0x52,
+    [0x53] = &title_font_0x53,
+    [0x54] = &title_font_0x54,
+    [0x55] = &title_font_0x55,
+    [0x56] = &title_font_0x56,
+    [0x57] = &title_font_0x57,
+    [0x58] = &title_font_0x58,
+    [0x59] = &title_font_0x59,
+    [0x5a] = &title_font_0x5a,
+    [0x5b] = &title_font_0x5b,
+    [0x5c] = &title_font_0x5c,
+    [0x5d] = &title_font_0x5d,
+    [0x5e] = &title_font_0x5e,
+    [0x5f] = &title_font_0x5f,
+    [0x60] = &title_font_0x60,
+    [0x61] = &title_font_0x61,
+    [0x62] = &title_font_0x62,
+    [0x63] = &title_font_0x63,
+    [0x64] = &title_font_0x64,
+    [0x65] = &title_font_0x65,
+    [0x66] = &title_font_0x66,
+    [0x67] = &title_font_0x67,
+    [0x68] = &title_font_0x68,
+    [0x69] = &title_font_0x69,
+    [0x6a] = &title_font_0x6a,
+    [0x6b] = &title_font_0x6b,
+    [0x6c] = &title_font_0x6c,
+    [0x6d] = &title_font_0x6d,
+    [0x6e] = &title_font_0x6e,
+    [0x6f] = &title_font_0x6f,
+    [0x70] = &title_font_0x70,
+    [0x71] = &title_font_0x71,
+    [0x72] = &title_font_0x72,
+    [0x73] = &title_font_0x73,
+    [0x74] = &title_font_0x74,
+    [0x75] = &title_font_0x75,
+    [0x76] = &title_font_0x76,
+    [0x77] = &title_font_0x77,
+    [0x78] = &title_font_0x78,
+    [0x79] = &title_font_0x79,
+    [0x7a] = &title_font_0x7a,
+    [0x7b] = &title_font_0x7b,
+    [0x7c] = &title_font_0x7c,
+    [0x7d] = &title_font_0x7d,
+    [0x7e] = &title_font_0x7e
+};
+
+static const uint8_t title_font_widths[FONT_TABLE_SIZE] =
+{
+     9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+     9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+     5,  3,  5,  8,  7,  9,  8,  3,  4,  4,  7,  7,  4,  7,  4,  9,
+     7,  4,  7,  7,  7,  7,  7,  7,  7,  7,  4,  4,  6,  7,  6,  7,
+     9,  7,  7,  7,  7,  7,  7,  7,  7,  5,  7,  7,  7,  9,  7,  7,
+     7,  7,  7,  7,  7,  7,  7,  9,  7,  7,  7,  5,  9,  5,  5,  7,
+     4,  7,  7,  7,  7,  7,  6,  7,  7,  3,  4,  6,  3,  9,  7,  7,
+     7,  7,  6,  7,  6,  7,  7,  9,  7,  7,  7,  6,  3,  6,  7,  9
+};
+
 static const Font title_font = { sizeof(title_font_array)/sizeof(title_font_array[0]),
-                                 10, title_font_array };
+                                 10, title_font_array,
+                                 title_font_table, title_font_widths };
 
 /* --- Body Font ----------------------------------------------------------- */
 
-static const uint8_t image_data_body_font_0x20[40] =
+static const uint16_t image_data_body_font_0x20[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000  /* .... */
 };
 static const CharacterImage body_font_0x20 = { image_data_body_font_0x20, 4, 10};
 
-static const uint8_t image_data_body_font_0x21[20] =
+static const uint16_t image_data_body_font_0x21[10] =
 {
-    0xff, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0xff, 0xff,
-    0x00, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+    0x0000, /* .. */
+    0x0001, /* #. */
+    0x0001, /* #. */
+    0x0001, /* #. */
+    0x0001, /* #. */
+    0x0001, /* #. */
+    0x0000, /* .. */
+    0x0001, /* #. */
+    0x0000, /* .. */
+    0x0000  /* .. */
 };
 static const CharacterImage body_font_0x21 = { image_data_body_font_0x21, 2, 10};
 
-static const uint8_t image_data_body_font_0x22[40] =
+static const uint16_t image_data_body_font_0x22[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
+    0x0000, /* .... */
+    0x0005, /* #.#. */
+    0x0005, /* #.#. */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000  /* .... */
 };
 static const CharacterImage body_font_0x22 = { image_data_body_font_0x22, 4, 10};
 
-static const uint8_t image_data_body_font_0x23[70] =
+static const uint16_t image_data_body_font_0x23[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0012, /* .#..#.. */
+    0x003f, /* ######. */
+    0x0012, /* .#..#.. */
+    0x0012, /* .#..#.. */
+    0x003f, /* ######. */
+    0x0012, /* .#..#.. */
+    0x0000, /* ....... */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage body_font_0x23 = { image_data_body_font_0x23, 7, 10};
 
-static const uint8_t image_data_body_font_0x24[60] =
+static const uint16_t image_data_body_font_0x24[10] =
 {
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0004, /* ..#... */
+    0x001e, /* .####. */
+    0x0005, /* #.#... */
+    0x0005, /* #.#... */
+    0x000e, /* .###.. */
+    0x0014, /* ..#.#. */
+    0x0014, /* ..#.#. */
+    0x000f, /* ####.. */
+    0x0004, /* ..#... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x24 = { image_data_body_font_0x24, 6, 10};
 
-static const uint8_t image_data_body_font_0x25[80] =
+static const uint16_t image_data_body_font_0x25[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ........ */
+    0x0042, /* .#....#. */
+    0x0025, /* #.#..#.. */
+    0x0012, /* .#..#... */
+    0x0008, /* ...#.... */
+    0x0024, /* ..#..#.. */
+    0x0052, /* .#..#.#. */
+    0x0021, /* #....#.. */
+    0x0000, /* ........ */
+    0x0000  /* ........ */
 };
 static const CharacterImage body_font_0x25 = { image_data_body_font_0x25, 8, 10};
 
-static const uint8_t image_data_body_font_0x26[70] =
+static const uint16_t image_data_body_font_0x26[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0006, /* .##.... */
+    0x0009, /* #..#... */
+    0x0009, /* #..#... */
+    0x0006, /* .##.... */
+    0x0029, /* #..#.#. */
+    0x0011, /* #...#.. */
+    0x002e, /* .###.#. */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage body_font_0x26 = { image_data_body_font_0x26, 7, 10};
 
-static const uint8_t image_data_body_font_0x27[20] =
+static const uint16_t image_data_body_font_0x27[10] =
 {
-    0xff, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+    0x0000, /* .. */
+    0x0001, /* #. */
+    0x0001, /* #. */
+    0x0000, /* .. */
+    0x0000, /* .. */
+    0x0000, /* .. */
+    0x0000, /* .. */
+    0x0000, /* .. */
+    0x0000, /* .. */
+    0x0000  /* .. */
 };
 static const CharacterImage body_font_0x27 = { image_data_body_font_0x27, 2, 10};
 
-static const uint8_t image_data_body_font_0x28[30] =
+static const uint16_t image_data_body_font_0x28[10] =
 {
-    0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff
+    0x0002, /* .#. */
+    0x0001, /* #.. */
+    0x0001, /* #.. */
+    0x0001, /* #.. */
+    0x0001, /* #.. */
+    0x0001, /* #.. */
+    0x0001, /* #.. */
+    0x0001, /* #.. */
+    0x0002, /* .#. */
+    0x0000  /* ... */
 };
 static const CharacterImage body_font_0x28 = { image_data_body_font_0x28, 3, 10};
 
-static const uint8_t image_data_body_font_0x29[30] =
+static const uint16_t image_data_body_font_0x29[10] =
 {
-    0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff
+    0x0001, /* #.. */
+    0x0002, /* .#. */
+    0x0002, /* .#. */
+    0x0002, /* .#. */
+    0x0002, /* .#. */
+    0x0002, /* .#. */
+    0x0002, /* .#. */
+    0x0002, /* .#. */
+    0x0001, /* #.. */
+    0x0000  /* ... */
 };
 static const CharacterImage body_font_0x29 = { image_data_body_font_0x29, 3, 10};
 
-static const uint8_t image_data_body_font_0x2a[60] =
+static const uint16_t image_data_body_font_0x2a[10] =
 {
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0004, /* ..#... */
+    0x0015, /* #.#.#. */
+    0x000e, /* .###.. */
+    0x0015, /* #.#.#. */
+    0x0004, /* ..#... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x2a = { image_data_body_font_0x2a, 6, 10};
 
-static const uint8_t image_data_body_font_0x2b[60] =
+static const uint16_t image_data_body_font_0x2b[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0004, /* ..#... */
+    0x0004, /* ..#... */
+    0x001f, /* #####. */
+    0x0004, /* ..#... */
+    0x0004, /* ..#... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x2b = { image_data_body_font_0x2b, 6, 10};
 
-static const uint8_t image_data_body_font_0x2c[30] =
+static const uint16_t image_data_body_font_0x2c[10] =
 {
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff
+    0x0000, /* ... */
+    0x0000, /* ... */
+    0x0000, /* ... */
+    0x0000, /* ... */
+    0x0000, /* ... */
+    0x0000, /* ... */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0002, /* .#. */
+    0x0001  /* #.. */
 };
 static const CharacterImage body_font_0x2c = { image_data_body_font_0x2c, 3, 10};
 
-static const uint8_t image_data_body_font_0x2d[60] =
+static const uint16_t image_data_body_font_0x2d[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x001f, /* #####. */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x2d = { image_data_body_font_0x2d, 6, 10};
 
-static const uint8_t image_data_body_font_0x2e[30] =
+static const uint16_t image_data_body_font_0x2e[10] =
 {
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
+    0x0000, /* ... */
+    0x0000, /* ... */
+    0x0000, /* ... */
+    0x0000, /* ... */
+    0x0000, /* ... */
+    0x0000, /* ... */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0000, /* ... */
+    0x0000  /* ... */
 };
 static const CharacterImage body_font_0x2e = { image_data_body_font_0x2e, 3, 10};
 
-static const uint8_t image_data_body_font_0x2f[80] =
+static const uint16_t image_data_body_font_0x2f[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ........ */
+    0x0040, /* ......#. */
+    0x0020, /* .....#.. */
+    0x0010, /* ....#... */
+    0x0008, /* ...#.... */
+    0x0004, /* ..#..... */
+    0x0002, /* .#...... */
+    0x0001, /* #....... */
+    0x0000, /* ........ */
+    0x0000  /* ........ */
 };
 static const CharacterImage body_font_0x2f = { image_data_body_font_0x2f, 8, 10};
 
-static const uint8_t image_data_body_font_0x30[60] =
+static const uint16_t image_data_body_font_0x30[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x000e, /* .###.. */
+    0x0011, /* #...#. */
+    0x0019, /* #..##. */
+    0x0015, /* #.#.#. */
+    0x0013, /* ##..#. */
+    0x0011, /* #...#. */
+    0x000e, /* .###.. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x30 = { image_data_body_font_0x30, 6, 10};
 
-static const uint8_t image_data_body_font_0x31[30] =
+static const uint16_t image_data_body_font_0x31[10] =
 {
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
+    0x0000, /* ... */
+    0x0003, /* ##. */
+    0x0002, /* .#. */
+    0x0002, /* .#. */
+    0x0002, /* .#. */
+    0x0002, /* .#. */
+    0x0002, /* .#. */
+    0x0002, /* .#. */
+    0x0000, /* ... */
+    0x0000  /* ... */
 };
 static const CharacterImage body_font_0x31 = { image_data_body_font_0x31, 3, 10};
 
-static const uint8_t image_data_body_font_0x32[60] =
+static const uint16_t image_data_body_font_0x32[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x000f, /* ####.. */
+    0x0010, /* ....#. */
+    0x0010, /* ....#. */
+    0x000e, /* .###.. */
+    0x0001, /* #..... */
+    0x0001, /* #..... */
+    0x001f, /* #####. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x32 = { image_data_body_font_0x32, 6, 10};
 
-static const uint8_t image_data_body_font_0x33[60] =
+static const uint16_t image_data_body_font_0x33[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x000f, /* ####.. */
+    0x0010, /* ....#. */
+    0x0010, /* ....#. */
+    0x000e, /* .###.. */
+    0x0010, /* ....#. */
+    0x0010, /* ....#. */
+    0x000f, /* ####.. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x33 = { image_data_body_font_0x33, 6, 10};
 
-static const uint8_t image_data_body_font_0x34[60] =
+static const uint16_t image_data_body_font_0x34[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0008, /* ...#.. */
+    0x000c, /* ..##.. */
+    0x000a, /* .#.#.. */
+    0x0009, /* #..#.. */
+    0x001f, /* #####. */
+    0x0008, /* ...#.. */
+    0x0008, /* ...#.. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x34 = { image_data_body_font_0x34, 6, 10};
 
-static const uint8_t image_data_body_font_0x35[60] =
+static const uint16_t image_data_body_font_0x35[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x001f, /* #####. */
+    0x0001, /* #..... */
+    0x0001, /* #..... */
+    0x000f, /* ####.. */
+    0x0010, /* ....#. */
+    0x0010, /* ....#. */
+    0x000f, /* ####.. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x35 = { image_data_body_font_0x35, 6, 10};
 
-static const uint8_t image_data_body_font_0x36[60] =
+static const uint16_t image_data_body_font_0x36[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x000e, /* .###.. */
+    0x0001, /* #..... */
+    0x0001, /* #..... */
+    0x000f, /* ####.. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x000e, /* .###.. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x36 = { image_data_body_font_0x36, 6, 10};
 
-static const uint8_t image_data_body_font_0x37[60] =
+static const uint16_t image_data_body_font_0x37[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x001f, /* #####. */
+    0x0010, /* ....#. */
+    0x0008, /* ...#.. */
+    0x0008, /* ...#.. */
+    0x0004, /* ..#... */
+    0x0004, /* ..#... */
+    0x0002, /* .#.... */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x37 = { image_data_body_font_0x37, 6, 10};
 
-static const uint8_t image_data_body_font_0x38[60] =
+static const uint16_t image_data_body_font_0x38[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x000e, /* .###.. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x000e, /* .###.. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x000e, /* .###.. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x38 = { image_data_body_font_0x38, 6, 10};
 
-static const uint8_t image_data_body_font_0x39[60] =
+static const uint16_t image_data_body_font_0x39[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x000e, /* .###.. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x001e, /* .####. */
+    0x0010, /* ....#. */
+    0x0010, /* ....#. */
+    0x000e, /* .###.. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x39 = { image_data_body_font_0x39, 6, 10};
 
-static const uint8_t image_data_body_font_0x3a[30] =
+static const uint16_t image_data_body_font_0x3a[10] =
 {
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
+    0x0000, /* ... */
+    0x0000, /* ... */
+    0x0000, /* ... */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0000, /* ... */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0000, /* ... */
+    0x0000  /* ... */
 };
 static const CharacterImage body_font_0x3a = { image_data_body_font_0x3a, 3, 10};
 
-static const uint8_t image_data_body_font_0x3b[30] =
+static const uint16_t image_data_body_font_0x3b[10] =
 {
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff
+    0x0000, /* ... */
+    0x0000, /* ... */
+    0x0000, /* ... */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0000, /* ... */
+    0x0003, /* ##. */
+    0x0003, /* ##. */
+    0x0002, /* .#. */
+    0x0001  /* #.. */
 };
 static const CharacterImage body_font_0x3b = { image_data_body_font_0x3b, 3, 10};
 
-static const uint8_t image_data_body_font_0x3c[50] =
+static const uint16_t image_data_body_font_0x3c[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ..... */
+    0x0008, /* ...#. */
+    0x0004, /* ..#.. */
+    0x0002, /* .#... */
+    0x0001, /* #.... */
+    0x0002, /* .#... */
+    0x0004, /* ..#.. */
+    0x0008, /* ...#. */
+    0x0000, /* ..... */
+    0x0000  /* ..... */
 };
 static const CharacterImage body_font_0x3c = { image_data_body_font_0x3c, 5, 10};
 
-static const uint8_t image_data_body_font_0x3d[60] =
+static const uint16_t image_data_body_font_0x3d[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x001f, /* #####. */
+    0x0000, /* ...... */
+    0x001f, /* #####. */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x3d = { image_data_body_font_0x3d, 6, 10};
 
-static const uint8_t image_data_body_font_0x3e[50] =
+static const uint16_t image_data_body_font_0x3e[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ..... */
+    0x0001, /* #.... */
+    0x0002, /* .#... */
+    0x0004, /* ..#.. */
+    0x0008, /* ...#. */
+    0x0004, /* ..#.. */
+    0x0002, /* .#... */
+    0x0001, /* #.... */
+    0x0000, /* ..... */
+    0x0000  /* ..... */
 };
 static const CharacterImage body_font_0x3e = { image_data_body_font_0x3e, 5, 10};
 
-static const uint8_t image_data_body_font_0x3f[60] =
+static const uint16_t image_data_body_font_0x3f[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x000e, /* .###.. */
+    0x0011, /* #...#. */
+    0x0010, /* ....#. */
+    0x0008, /* ...#.. */
+    0x0004, /* ..#... */
+    0x0000, /* ...... */
+    0x0004, /* ..#... */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x3f = { image_data_body_font_0x3f, 6, 10};
 
-static const uint8_t image_data_body_font_0x40[80] =
+static const uint16_t image_data_body_font_0x40[10] =
 {
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00,
-    0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x003c, /* ..####.. */
+    0x0042, /* .#....#. */
+    0x0099, /* #..##..# */
+    0x00a1, /* #....#.# */
+    0x00b9, /* #..###.# */
+    0x00a5, /* #.#..#.# */
+    0x0079, /* #..####. */
+    0x0002, /* .#...... */
+    0x003c, /* ..####.. */
+    0x0000  /* ........ */
 };
 static const CharacterImage body_font_0x40 = { image_data_body_font_0x40, 8, 10};
 
-static const uint8_t image_data_body_font_0x41[60] =
+static const uint16_t image_data_body_font_0x41[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x000e, /* .###.. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x001f, /* #####. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x41 = { image_data_body_font_0x41, 6, 10};
 
-static const uint8_t image_data_body_font_0x42[60] =
+static const uint16_t image_data_body_font_0x42[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x000f, /* ####.. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x000f, /* ####.. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x000f, /* ####.. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x42 = { image_data_body_font_0x42, 6, 10};
 
-static const uint8_t image_data_body_font_0x43[60] =
+static const uint16_t image_data_body_font_0x43[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x000e, /* .###.. */
+    0x0011, /* #...#. */
+    0x0001, /* #..... */
+    0x0001, /* #..... */
+    0x0001, /* #..... */
+    0x0011, /* #...#. */
+    0x000e, /* .###.. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x43 = { image_data_body_font_0x43, 6, 10};
 
-static const uint8_t image_data_body_font_0x44[60] =
+static const uint16_t image_data_body_font_0x44[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x000f, /* ####.. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x000f, /* ####.. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x44 = { image_data_body_font_0x44, 6, 10};
 
-static const uint8_t image_data_body_font_0x45[60] =
+static const uint16_t image_data_body_font_0x45[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x001f, /* #####. */
+    0x0001, /* #..... */
+    0x0001, /* #..... */
+    0x000f, /* ####.. */
+    0x0001, /* #..... */
+    0x0001, /* #..... */
+    0x001f, /* #####. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x45 = { image_data_body_font_0x45, 6, 10};
 
-static const uint8_t image_data_body_font_0x46[60] =
+static const uint16_t image_data_body_font_0x46[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x001f, /* #####. */
+    0x0001, /* #..... */
+    0x0001, /* #..... */
+    0x000f, /* ####.. */
+    0x0001, /* #..... */
+    0x0001, /* #..... */
+    0x0001, /* #..... */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x46 = { image_data_body_font_0x46, 6, 10};
 
-static const uint8_t image_data_body_font_0x47[60] =
+static const uint16_t image_data_body_font_0x47[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x000e, /* .###.. */
+    0x0011, /* #...#. */
+    0x0001, /* #..... */
+    0x001d, /* #.###. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x001e, /* .####. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x47 = { image_data_body_font_0x47, 6, 10};
 
-static const uint8_t image_data_body_font_0x48[60] =
+static const uint16_t image_data_body_font_0x48[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x001f, /* #####. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x48 = { image_data_body_font_0x48, 6, 10};
 
-static const uint8_t image_data_body_font_0x49[40] =
+static const uint16_t image_data_body_font_0x49[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
+    0x0000, /* .... */
+    0x0007, /* ###. */
+    0x0002, /* .#.. */
+    0x0002, /* .#.. */
+    0x0002, /* .#.. */
+    0x0002, /* .#.. */
+    0x0002, /* .#.. */
+    0x0007, /* ###. */
+    0x0000, /* .... */
+    0x0000  /* .... */
 };
 static const CharacterImage body_font_0x49 = { image_data_body_font_0x49, 4, 10};
 
-static const uint8_t image_data_body_font_0x4a[60] =
+static const uint16_t image_data_body_font_0x4a[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0010, /* ....#. */
+    0x0010, /* ....#. */
+    0x0010, /* ....#. */
+    0x0010, /* ....#. */
+    0x0010, /* ....#. */
+    0x0011, /* #...#. */
+    0x000e, /* .###.. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x4a = { image_data_body_font_0x4a, 6, 10};
 
-static const uint8_t image_data_body_font_0x4b[60] =
+static const uint16_t image_data_body_font_0x4b[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0011, /* #...#. */
+    0x0009, /* #..#.. */
+    0x0005, /* #.#... */
+    0x0003, /* ##.... */
+    0x0005, /* #.#... */
+    0x0009, /* #..#.. */
+    0x0011, /* #...#. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x4b = { image_data_body_font_0x4b, 6, 10};
 
-static const uint8_t image_data_body_font_0x4c[60] =
+static const uint16_t image_data_body_font_0x4c[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0001, /* #..... */
+    0x0001, /* #..... */
+    0x0001, /* #..... */
+    0x0001, /* #..... */
+    0x0001, /* #..... */
+    0x0001, /* #..... */
+    0x001f, /* #####. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x4c = { image_data_body_font_0x4c, 6, 10};
 
-static const uint8_t image_data_body_font_0x4d[80] =
+static const uint16_t image_data_body_font_0x4d[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ........ */
+    0x0041, /* #.....#. */
+    0x0063, /* ##...##. */
+    0x0055, /* #.#.#.#. */
+    0x0049, /* #..#..#. */
+    0x0041, /* #.....#. */
+    0x0041, /* #.....#. */
+    0x0041, /* #.....#. */
+    0x0000, /* ........ */
+    0x0000  /* ........ */
 };
 static const CharacterImage body_font_0x4d = { image_data_body_font_0x4d, 8, 10};
 
-static const uint8_t image_data_body_font_0x4e[60] =
+static const uint16_t image_data_body_font_0x4e[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0013, /* ##..#. */
+    0x0015, /* #.#.#. */
+    0x0019, /* #..##. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x4e = { image_data_body_font_0x4e, 6, 10};
 
-static const uint8_t image_data_body_font_0x4f[60] =
+static const uint16_t image_data_body_font_0x4f[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x000e, /* .###.. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x000e, /* .###.. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x4f = { image_data_body_font_0x4f, 6, 10};
 
-static const uint8_t image_data_body_font_0x50[60] =
+static const uint16_t image_data_body_font_0x50[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x000f, /* ####.. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x000f, /* ####.. */
+    0x0001, /* #..... */
+    0x0001, /* #..... */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x50 = { image_data_body_font_0x50, 6, 10};
 
-static const uint8_t image_data_body_font_0x51[60] =
+static const uint16_t image_data_body_font_0x51[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x000e, /* .###.. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x000e, /* .###.. */
+    0x0010, /* ....#. */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x51 = { image_data_body_font_0x51, 6, 10};
 
-static const uint8_t image_data_body_font_0x52[60] =
+static const uint16_t image_data_body_font_0x52[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x000f, /* ####.. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x000f, /* ####.. */
+    0x0009, /* #..#.. */
+    0x0011, /* #...#. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x52 = { image_data_body_font_0x52, 6, 10};
 
-static const uint8_t image_data_body_font_0x53[60] =
+static const uint16_t image_data_body_font_0x53[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x000e, /* .###.. */
+    0x0011, /* #...#. */
+    0x0001, /* #..... */
+    0x000e, /* .###.. */
+    0x0010, /* ....#. */
+    0x0011, /* #...#. */
+    0x000e, /* .###.. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x53 = { image_data_body_font_0x53, 6, 10};
 
-static const uint8_t image_data_body_font_0x54[60] =
+static const uint16_t image_data_body_font_0x54[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x001f, /* #####. */
+    0x0004, /* ..#... */
+    0x0004, /* ..#... */
+    0x0004, /* ..#... */
+    0x0004, /* ..#... */
+    0x0004, /* ..#... */
+    0x0004, /* ..#... */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x54 = { image_data_body_font_0x54, 6, 10};
 
-static const uint8_t image_data_body_font_0x55[60] =
+static const uint16_t image_data_body_font_0x55[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x000e, /* .###.. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x55 = { image_data_body_font_0x55, 6, 10};
 
-static const uint8_t image_data_body_font_0x56[60] =
+static const uint16_t image_data_body_font_0x56[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x000a, /* .#.#.. */
+    0x000a, /* .#.#.. */
+    0x0004, /* ..#... */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x56 = { image_data_body_font_0x56, 6, 10};
 
-static const uint8_t image_data_body_font_0x57[80] =
+static const uint16_t image_data_body_font_0x57[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ........ */
+    0x0049, /* #..#..#. */
+    0x0049, /* #..#..#. */
+    0x0049, /* #..#..#. */
+    0x0049, /* #..#..#. */
+    0x0049, /* #..#..#. */
+    0x0049, /* #..#..#. */
+    0x0036, /* .##.##.. */
+    0x0000, /* ........ */
+    0x0000  /* ........ */
 };
 static const CharacterImage body_font_0x57 = { image_data_body_font_0x57, 8, 10};
 
-static const uint8_t image_data_body_font_0x58[60] =
+static const uint16_t image_data_body_font_0x58[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x000a, /* .#.#.. */
+    0x0004, /* ..#... */
+    0x000a, /* .#.#.. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x58 = { image_data_body_font_0x58, 6, 10};
 
-static const uint8_t image_data_body_font_0x59[60] =
+static const uint16_t image_data_body_font_0x59[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x000a, /* .#.#.. */
+    0x0004, /* ..#... */
+    0x0004, /* ..#... */
+    0x0004, /* ..#... */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x59 = { image_data_body_font_0x59, 6, 10};
 
-static const uint8_t image_data_body_font_0x5a[60] =
+static const uint16_t image_data_body_font_0x5a[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x001f, /* #####. */
+    0x0010, /* ....#. */
+    0x0008, /* ...#.. */
+    0x0004, /* ..#... */
+    0x0002, /* .#.... */
+    0x0001, /* #..... */
+    0x001f, /* #####. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x5a = { image_data_body_font_0x5a, 6, 10};
 
-static const uint8_t image_data_body_font_0x5b[40] =
+static const uint16_t image_data_body_font_0x5b[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
+    0x0000, /* .... */
+    0x0007, /* ###. */
+    0x0001, /* #... */
+    0x0001, /* #... */
+    0x0001, /* #... */
+    0x0001, /* #... */
+    0x0001, /* #... */
+    0x0007, /* ###. */
+    0x0000, /* .... */
+    0x0000  /* .... */
 };
 static const CharacterImage body_font_0x5b = { image_data_body_font_0x5b, 4, 10};
 
-static const uint8_t image_data_body_font_0x5c[80] =
+static const uint16_t image_data_body_font_0x5c[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ........ */
+    0x0001, /* #....... */
+    0x0002, /* .#...... */
+    0x0004, /* ..#..... */
+    0x0008, /* ...#.... */
+    0x0010, /* ....#... */
+    0x0020, /* .....#.. */
+    0x0040, /* ......#. */
+    0x0000, /* ........ */
+    0x0000  /* ........ */
 };
 static const CharacterImage body_font_0x5c = { image_data_body_font_0x5c, 8, 10};
 
-static const uint8_t image_data_body_font_0x5d[40] =
+static const uint16_t image_data_body_font_0x5d[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
+    0x0000, /* .... */
+    0x0007, /* ###. */
+    0x0004, /* ..#. */
+    0x0004, /* ..#. */
+    0x0004, /* ..#. */
+    0x0004, /* ..#. */
+    0x0004, /* ..#. */
+    0x0007, /* ###. */
+    0x0000, /* .... */
+    0x0000  /* .... */
 };
 static const CharacterImage body_font_0x5d = { image_data_body_font_0x5d, 4, 10};
 
-static const uint8_t image_data_body_font_0x5e[40] =
+static const uint16_t image_data_body_font_0x5e[10] =
 {
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff
+    0x0000, /* .... */
+    0x0002, /* .#.. */
+    0x0005, /* #.#. */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000, /* .... */
+    0x0000  /* .... */
 };
 static const CharacterImage body_font_0x5e = { image_data_body_font_0x5e, 4, 10};
 
-static const uint8_t image_data_body_font_0x5f[60] =
+static const uint16_t image_data_body_font_0x5f[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x001f, /* #####. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x5f = { image_data_body_font_0x5f, 6, 10};
 
-static const uint8_t image_data_body_font_0x60[30] =
+static const uint16_t image_data_body_font_0x60[10] =
 {
-    0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
+    0x0000, /* ... */
+    0x0001, /* #.. */
+    0x0002, /* .#. */
+    0x0000, /* ... */
+    0x0000, /* ... */
+    0x0000, /* ... */
+    0x0000, /* ... */
+    0x0000, /* ... */
+    0x0000, /* ... */
+    0x0000  /* ... */
 };
 static const CharacterImage body_font_0x60 = { image_data_body_font_0x60, 3, 10};
 
-static const uint8_t image_data_body_font_0x61[60] =
+static const uint16_t image_data_body_font_0x61[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x000e, /* .###.. */
+    0x0010, /* ....#. */
+    0x001e, /* .####. */
+    0x0011, /* #...#. */
+    0x001e, /* .####. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x61 = { image_data_body_font_0x61, 6, 10};
 
-static const uint8_t image_data_body_font_0x62[60] =
+static const uint16_t image_data_body_font_0x62[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0001, /* #..... */
+    0x0001, /* #..... */
+    0x000f, /* ####.. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x000f, /* ####.. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x62 = { image_data_body_font_0x62, 6, 10};
 
-static const uint8_t image_data_body_font_0x63[60] =
+static const uint16_t image_data_body_font_0x63[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x001e, /* .####. */
+    0x0001, /* #..... */
+    0x0001, /* #..... */
+    0x0001, /* #..... */
+    0x001e, /* .####. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x63 = { image_data_body_font_0x63, 6, 10};
 
-static const uint8_t image_data_body_font_0x64[60] =
+static const uint16_t image_data_body_font_0x64[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0010, /* ....#. */
+    0x0010, /* ....#. */
+    0x001e, /* .####. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x001e, /* .####. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x64 = { image_data_body_font_0x64, 6, 10};
 
-static const uint8_t image_data_body_font_0x65[60] =
+static const uint16_t image_data_body_font_0x65[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x000e, /* .###.. */
+    0x0011, /* #...#. */
+    0x001f, /* #####. */
+    0x0001, /* #..... */
+    0x001e, /* .####. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x65 = { image_data_body_font_0x65, 6, 10};
 
-static const uint8_t image_data_body_font_0x66[50] =
+static const uint16_t image_data_body_font_0x66[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ..... */
+    0x000c, /* ..##. */
+    0x0002, /* .#... */
+    0x000f, /* ####. */
+    0x0002, /* .#... */
+    0x0002, /* .#... */
+    0x0002, /* .#... */
+    0x0002, /* .#... */
+    0x0000, /* ..... */
+    0x0000  /* ..... */
 };
 static const CharacterImage body_font_0x66 = { image_data_body_font_0x66, 5, 10};
 
-static const uint8_t image_data_body_font_0x67[60] =
+static const uint16_t image_data_body_font_0x67[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x001e, /* .####. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x001e, /* .####. */
+    0x0010, /* ....#. */
+    0x000e  /* .###.. */
 };
 static const CharacterImage body_font_0x67 = { image_data_body_font_0x67, 6, 10};
 
-static const uint8_t image_data_body_font_0x68[60] =
+static const uint16_t image_data_body_font_0x68[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0001, /* #..... */
+    0x0001, /* #..... */
+    0x000f, /* ####.. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x68 = { image_data_body_font_0x68, 6, 10};
 
-static const uint8_t image_data_body_font_0x69[20] =
+static const uint16_t image_data_body_font_0x69[10] =
 {
-    0xff, 0xff,
-    0x00, 0xff,
-    0xff, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+    0x0000, /* .. */
+    0x0001, /* #. */
+    0x0000, /* .. */
+    0x0001, /* #. */
+    0x0001, /* #. */
+    0x0001, /* #. */
+    0x0001, /* #. */
+    0x0001, /* #. */
+    0x0000, /* .. */
+    0x0000  /* .. */
 };
 static const CharacterImage body_font_0x69 = { image_data_body_font_0x69, 2, 10};
 
-static const uint8_t image_data_body_font_0x6a[30] =
+static const uint16_t image_data_body_font_0x6a[10] =
 {
-    0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff
+    0x0000, /* ... */
+    0x0002, /* .#. */
+    0x0000, /* ... */
+    0x0002, /* .#. */
+    0x0002, /* .#. */
+    0x0002, /* .#. */
+    0x0002, /* .#. */
+    0x0002, /* .#. */
+    0x0002, /* .#. */
+    0x0001  /* #.. */
 };
 static const CharacterImage body_font_0x6a = { image_data_body_font_0x6a, 3, 10};
 
-static const uint8_t image_data_body_font_0x6b[50] =
+static const uint16_t image_data_body_font_0x6b[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ..... */
+    0x0001, /* #.... */
+    0x0001, /* #.... */
+    0x0009, /* #..#. */
+    0x0005, /* #.#.. */
+    0x0003, /* ##... */
+    0x0005, /* #.#.. */
+    0x0009, /* #..#. */
+    0x0000, /* ..... */
+    0x0000  /* ..... */
 };
 static const CharacterImage body_font_0x6b = { image_data_body_font_0x6b, 5, 10};
 
-static const uint8_t image_data_body_font_0x6c[20] =
+static const uint16_t image_data_body_font_0x6c[10] =
 {
-    0xff, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+    0x0000, /* .. */
+    0x0001, /* #. */
+    0x0001, /* #. */
+    0x0001, /* #. */
+    0x0001, /* #. */
+    0x0001, /* #. */
+    0x0001, /* #. */
+    0x0001, /* #. */
+    0x0000, /* .. */
+    0x0000  /* .. */
 };
 static const CharacterImage body_font_0x6c = { image_data_body_font_0x6c, 2, 10};
 
-static const uint8_t image_data_body_font_0x6d[80] =
+static const uint16_t image_data_body_font_0x6d[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ........ */
+    0x0000, /* ........ */
+    0x0000, /* ........ */
+    0x003f, /* ######.. */
+    0x0049, /* #..#..#. */
+    0x0049, /* #..#..#. */
+    0x0049, /* #..#..#. */
+    0x0049, /* #..#..#. */
+    0x0000, /* ........ */
+    0x0000  /* ........ */
 };
 static const CharacterImage body_font_0x6d = { image_data_body_font_0x6d, 8, 10};
 
-static const uint8_t image_data_body_font_0x6e[60] =
+static const uint16_t image_data_body_font_0x6e[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x000f, /* ####.. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x6e = { image_data_body_font_0x6e, 6, 10};
 
-static const uint8_t image_data_body_font_0x6f[60] =
+static const uint16_t image_data_body_font_0x6f[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x000e, /* .###.. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x000e, /* .###.. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x6f = { image_data_body_font_0x6f, 6, 10};
 
-static const uint8_t image_data_body_font_0x70[60] =
+static const uint16_t image_data_body_font_0x70[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x000f, /* ####.. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x000f, /* ####.. */
+    0x0001, /* #..... */
+    0x0001  /* #..... */
 };
 static const CharacterImage body_font_0x70 = { image_data_body_font_0x70, 6, 10};
 
-static const uint8_t image_data_body_font_0x71[60] =
+static const uint16_t image_data_body_font_0x71[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x001e, /* .####. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x001e, /* .####. */
+    0x0010, /* ....#. */
+    0x0010  /* ....#. */
 };
 static const CharacterImage body_font_0x71 = { image_data_body_font_0x71, 6, 10};
 
-static const uint8_t image_data_body_font_0x72[50] =
+static const uint16_t image_data_body_font_0x72[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ..... */
+    0x0000, /* ..... */
+    0x0000, /* ..... */
+    0x000d, /* #.##. */
+    0x0003, /* ##... */
+    0x0001, /* #.... */
+    0x0001, /* #.... */
+    0x0001, /* #.... */
+    0x0000, /* ..... */
+    0x0000  /* ..... */
 };
 static const CharacterImage body_font_0x72 = { image_data_body_font_0x72, 5, 10};
 
-static const uint8_t image_data_body_font_0x73[60] =
+static const uint16_t image_data_body_font_0x73[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x001e, /* .####. */
+    0x0001, /* #..... */
+    0x000e, /* .###.. */
+    0x0010, /* ....#. */
+    0x000f, /* ####.. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x73 = { image_data_body_font_0x73, 6, 10};
 
-static const uint8_t image_data_body_font_0x74[50] =
+static const uint16_t image_data_body_font_0x74[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ..... */
+    0x0002, /* .#... */
+    0x0002, /* .#... */
+    0x000f, /* ####. */
+    0x0002, /* .#... */
+    0x0002, /* .#... */
+    0x0002, /* .#... */
+    0x000c, /* ..##. */
+    0x0000, /* ..... */
+    0x0000  /* ..... */
 };
 static const CharacterImage body_font_0x74 = { image_data_body_font_0x74, 5, 10};
 
-static const uint8_t image_data_body_font_0x75[60] =
+static const uint16_t image_data_body_font_0x75[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x001e, /* .####. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x75 = { image_data_body_font_0x75, 6, 10};
 
-static const uint8_t image_data_body_font_0x76[60] =
+static const uint16_t image_data_body_font_0x76[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x000a, /* .#.#.. */
+    0x000a, /* .#.#.. */
+    0x0004, /* ..#... */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x76 = { image_data_body_font_0x76, 6, 10};
 
-static const uint8_t image_data_body_font_0x77[80] =
+static const uint16_t image_data_body_font_0x77[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ........ */
+    0x0000, /* ........ */
+    0x0000, /* ........ */
+    0x0049, /* #..#..#. */
+    0x0049, /* #..#..#. */
+    0x0049, /* #..#..#. */
+    0x0049, /* #..#..#. */
+    0x0036, /* .##.##.. */
+    0x0000, /* ........ */
+    0x0000  /* ........ */
 };
 static const CharacterImage body_font_0x77 = { image_data_body_font_0x77, 8, 10};
 
-static const uint8_t image_data_body_font_0x78[60] =
+static const uint16_t image_data_body_font_0x78[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0011, /* #...#. */
+    0x000a, /* .#.#.. */
+    0x0004, /* ..#... */
+    0x000a, /* .#.#.. */
+    0x0011, /* #...#. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x78 = { image_data_body_font_0x78, 6, 10};
 
-static const uint8_t image_data_body_font_0x79[60] =
+static const uint16_t image_data_body_font_0x79[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x0011, /* #...#. */
+    0x001e, /* .####. */
+    0x0010, /* ....#. */
+    0x000e  /* .###.. */
 };
 static const CharacterImage body_font_0x79 = { image_data_body_font_0x79, 6, 10};
 
-static const uint8_t image_data_body_font_0x7a[60] =
+static const uint16_t image_data_body_font_0x7a[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x0000, /* ...... */
+    0x001f, /* #####. */
+    0x0008, /* ...#.. */
+    0x0004, /* ..#... */
+    0x0002, /* .#.... */
+    0x001f, /* #####. */
+    0x0000, /* ...... */
+    0x0000  /* ...... */
 };
 static const CharacterImage body_font_0x7a = { image_data_body_font_0x7a, 6, 10};
 
-static const uint8_t image_data_body_font_0x7b[50] =
+static const uint16_t image_data_body_font_0x7b[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ..... */
+    0x000c, /* ..##. */
+    0x0002, /* .#... */
+    0x0002, /* .#... */
+    0x0001, /* #.... */
+    0x0002, /* .#... */
+    0x0002, /* .#... */
+    0x000c, /* ..##. */
+    0x0000, /* ..... */
+    0x0000  /* ..... */
 };
 static const CharacterImage body_font_0x7b = { image_data_body_font_0x7b, 5, 10};
 
-static const uint8_t image_data_body_font_0x7c[20] =
+static const uint16_t image_data_body_font_0x7c[10] =
 {
-    0xff, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0x00, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
+    0x0000, /* .. */
+    0x0001, /* #. */
+    0x0001, /* #. */
+    0x0001, /* #. */
+    0x0001, /* #. */
+    0x0001, /* #. */
+    0x0001, /* #. */
+    0x0001, /* #. */
+    0x0000, /* .. */
+    0x0000  /* .. */
 };
 static const CharacterImage body_font_0x7c = { image_data_body_font_0x7c, 2, 10};
 
-static const uint8_t image_data_body_font_0x7d[50] =
+static const uint16_t image_data_body_font_0x7d[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ..... */
+    0x0003, /* ##... */
+    0x0004, /* ..#.. */
+    0x0004, /* ..#.. */
+    0x0008, /* ...#. */
+    0x0004, /* ..#.. */
+    0x0004, /* ..#.. */
+    0x0003, /* ##... */
+    0x0000, /* ..... */
+    0x0000  /* ..... */
 };
 static const CharacterImage body_font_0x7d = { image_data_body_font_0x7d, 5, 10};
 
-static const uint8_t image_data_body_font_0x7e[70] =
+static const uint16_t image_data_body_font_0x7e[10] =
 {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    0x0000, /* ....... */
+    0x0040, /* ......# */
+    0x0040, /* ......# */
+    0x0020, /* .....#. */
+    0x0020, /* .....#. */
+    0x0012, /* .#..#.. */
+    0x0014, /* ..#.#.. */
+    0x0008, /* ...#... */
+    0x0000, /* ....... */
+    0x0000  /* ....... */
 };
 static const CharacterImage body_font_0x7e = { image_data_body_font_0x7e, 7, 10};
 
@@ -3669,8 +3809,121 @@ static const Character body_font_array[] =
 
 };
 
+/* Direct-indexed by character code */
+static const CharacterImage *const body_font_table[FONT_TABLE_SIZE] =
+{
+    [0x20] = &body_font_0x20,
+    [0x21] = &body_font_0x21,
+    [0x22] = &body_font_0x22,
+    [0x23] = &body_font_0x23,
+    [0x24] = &body_font_0x24,
+    [0x25] = &body_font_0x25,
+    [0x26] = &body_font_0x26,
+    [0x27] = &body_font_0x27,
+    [0x28] = &body_font_0x28,
+    [0x29] = &body_font_0x29,
+    [0x2a] = &body_font_0x2a,
+    [0x2b] = &body_font_0x2b,
+    [0x2c] = &body_font_0x2c,
+    [0x2d] = &body_font_0x2d,
+    [0x2e] = &body_font_0x2e,
+    [0x2f] = &body_font_0x2f,
+    [0x30] = &body_font_0x30,
+    [0x31] = &body_font_0x31,
+    [0x32] = &body_font_0x32,
+    [0x33] = &body_font_0x33,
+    [0x34] = &body_font_0x34,
+    [0x35] = &body_font_0x35,
+    [0x36] = &body_font_0x36,
+    [0x37] = &body_font_0x37,
+    [0x38] = &body_font_0x38,
+    [0x39] = &body_font_0x39,
+    [0x3a] = &body_font_0x3a,
+    [0x3b] = &body_font_0x3b,
+    [0x3c] = &body_font_0x3c,
+    [0x3d] = &body_font_0x3d,
+    [0x3e] = &body_font_0x3e,
+    [0x3f] = &body_font_0x3f,
+    [0x40] = &body_font_0x40,
+    [0x41] = &body_font_0x41,
+    [0x42] = &body_font_0x42,
+    [0x43] = &body_font_0x43,
+    [0x44] = &body_font_0x44,
+    [0x45] = &body_font_0x45,
+    [0x46] = &body_font_0x46,
+    [0x47] = &body_font_0x47,
+    [0x48] = &body_font_0x48,
+    [0x49] = &body_font_0x49,
+    [0x4a] = &body_font_0x4a,
+    [0x4b] = &body_font_0x4b,
+    [0x4c] = &body_font_0x4c,
+    [0x4d] = &body_font_0x4d,
+    [0x4e] = &body_font_0x4e,
+    [0x4f] = &body_font_0x4f,
+    [0x50] = &body_font_0x50,
+    [0x51] = &body_font_0x51,
+    [0x52] = &body_font_0x52,
+    [0x53] = &body_font_0x53,
+    [0x54] = &body_font_0x54,
+    [0x55] = &body_font_0x55,
+    [0x56] = &body_font_0x56,
+    [0x57] = &body_font_0x57,
+    [0x58] = &body_font_0x58,
+    [0x59] = &body_font_0x59,
+    [0x5a] = &body_font_0x5a,
+    [0x5b] = &body_font_0x5b,
+    [0x5c] = &body_font_0x5c,
+    [0x5d] = &body_font_0x5d,
+    [0x5e] = &body_font_0x5e,
+    [0x5f] = &body_font_0x5f,
+    [0x60] = &body_font_0x60,
+    [0x61] = &body_font_0x61,
+    [0x62] = &body_font_0x62,
+    [0x63] = &body_font_0x63,
+    [0x64] = &body_font_0x64,
+    [0x65] = &body_font_0x65,
+    [0x66] = &body_font_0x66,
+    [0x67] = &body_font_0x67,
+    [0x68] = &body_font_0x68,
+    [0x69] = &body_font_0x69,
+    [0x6a] = &body_font_0x6a,
+    [0x6b] = &body_font_0x6b,
+    [0x6c] = &body_font_0x6c,
+    [0x6d] = &body_font_0x6d,
+    [0x6e] = &body_font_0x6e,
+    [0x6f] = &body_font_0x6f,
+    [0x70] = &body_font_0x70,
+    [0x71] = &body_font_0x71,
+    [0x72] = &body_font_0x72,
+    [0x73] = &body_font_0x73,
+    [0x74] = &body_font_0x74,
+    [0x75] = &body_font_0x75,
+    [0x76] = &body_font_0x76,
+    [0x77] = &body_font_0x77,
+    [0x78] = &body_font_0x78,
+    [0x79] = &body_font_0x79,
+    [0x7a] = &body_font_0x7a,
+    [0x7b] = &body_font_0x7b,
+    [0x7c] = &body_font_0x7c,
+    [0x7d] = &body_font_0x7d,
+    [0x7e] = &body_font_0x7e
+};
+
+static const uint8_t body_font_widths[FONT_TABLE_SIZE] =
+{
+     9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+     9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+     4,  2,  4,  7,  6,  8,  7,  2,  3,  3,  6,  6,  3,  6,  3,  8,
+     6,  3,  6,  6,  6,  6,  6,  6,  6,  6,  3,  3,  5,  6,  5,  6,
+     8,  6,  6,  6,  6,  6,  6,  6,  6,  4,  6,  6,  6,  8,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  8,  6,  6,  6,  4,  8,  4,  4,  6,
+     3,  6,  6,  6,  6,  6,  5,  6,  6,  2,  3,  5,  2,  8,  6,  6,
+     6,  6,  5,  6,  5,  6,  6,  8,  6,  6,  6,  5,  2,  5,  7,  9
+};
+
 static const Font body_font = { sizeof(body_font_array)/sizeof(body_font_array[0]),
-                                10, body_font_array };
+                                10, body_font_array,
+                                body_font_table, body_font_widths };
 
 /* === Functions =========================================================== */
 
@@ -3729,17 +3982,38 @@ const Font *get_body_font(void)
  */
 const CharacterImage *font_get_char(const Font *font, char c)
 {
-    for (int i = 0; i < font->length; i++)
+    unsigned char code = (unsigned char)c;
+
+    if(code < FONT_TABLE_SIZE && font->table[ code ] != NULL)
     {
-        if(font->characters[ i ].code == c)
-        {
-            return font->characters[ i ].image;
-        }
+        return font->table[ code ];
     }
 
     return &sadface_9x10;
 }
 
+/*
+ * font_char_width() - Get the width of a character in the provided font
+ *
+ * INPUT
+ *     - font: pointer to font structure
+ *     - c: ascii charactor
+ * OUTPUT
+ *     width of the character's image
+ *
+ */
+uint32_t font_char_width(const Font *font, char c)
+{
+    unsigned char code = (unsigned char)c;
+
+    if(code < FONT_TABLE_SIZE)
+    {
+        return font->widths[ code ];
+    }
+
+    return sadface_9x10.width;
+}
+
 /*
  * font_height() - Get font height
  *
@@ -3764,7 +4038,7 @@ uint32_t font_height(const Font *font)
 uint32_t font_width(const Font *font)
 {
     /*Return worst case width using the | char as the reference.  */
-    return  font_get_char(font, '|')->width;
+    return  font_char_width(font, '|');
 }
 
 /*
@@ -3782,7 +4056,7 @@ uint32_t calc_str_width(const Font *font, const char *str)
 
     while(str[0] != '\0')
     {
-        width += font_get_char(font, str[0])->width;
+        width += font_char_width(font, str[0]);
         str++;
     }
 
@@ -3806,7 +4080,7 @@ uint32_t calc_str_line(const Font *font, const char *str, uint16_t line_width)
 
     while(*str)
     {
-        uint8_t character_width = font_get_char(font, str[0])->width;
+        uint8_t character_width = font_char_width(font, str[0]);
         uint16_t word_width = character_width;
         char *next_character = (char *)str + 1;
 
@@ -3824,7 +4098,7 @@ uint32_t calc_str_line(const Font *font, const char *str, uint16_t line_width)
         {
             while(*next_character && *next_character != ' ' && *next_character != '\n')
             {
-                word_width += font_get_char(font, *next_character)->width;
+                word_width += font_char_width(font, *next_character);
                 next_character++;
             }
         }
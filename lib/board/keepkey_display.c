@@ -20,6 +20,8 @@
 #ifndef EMULATOR
 #  include <libopencm3/stm32/rcc.h>
 #  include <libopencm3/stm32/gpio.h>
+#else
+#  include "keepkey/emulator/emulator.h"
 #endif
 
 #include "keepkey/board/keepkey_display.h"
@@ -284,6 +286,10 @@ Canvas *display_canvas_init(void)
     canvas.width    = KEEPKEY_DISPLAY_WIDTH;
     canvas.height   = KEEPKEY_DISPLAY_HEIGHT;
     canvas.dirty    = false;
+    canvas.dirty_x0 = 0;
+    canvas.dirty_y0 = 0;
+    canvas.dirty_x1 = 0;
+    canvas.dirty_y1 = 0;
 
     return &canvas;
 }
@@ -307,7 +313,31 @@ void display_set_dump_callback(DumpDisplayCallback d) {
 }
 
 /*
- * display_refresh() - Refresh display
+ * display_set_window() - Set the display ram region that following gram
+ * writes fill, in canvas pixel coordinates
+ *
+ * INPUT
+ *     - x0: left edge, a multiple of 4
+ *     - y0: top edge
+ *     - x1: right edge (exclusive), a multiple of 4
+ *     - y1: bottom edge (exclusive)
+ * OUTPUT
+ *     none
+ */
+static void display_set_window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+    /* Columns are in units of 4 pixels (2 bytes at 4 bits/pixel) */
+    display_write_reg((uint8_t)0x15);
+    display_write_ram(START_COL + x0 / 4);
+    display_write_ram(START_COL + x1 / 4 - 1);
+
+    display_write_reg((uint8_t)0x75);
+    display_write_ram(START_ROW + y0);
+    display_write_ram(START_ROW + y1 - 1);
+}
+
+/*
+ * display_refresh() - Refresh the dirty region of the display
  *
  * INPUT
  *     none
@@ -325,24 +355,43 @@ void display_refresh(void)
         return;
     }
 
+#if defined(EMULATOR)
+    /* No panel; hand the changed rows to the headless framebuffer */
+    emulatorPublishFrame(canvas.buffer, canvas.width, canvas.height,
+                         canvas.dirty_y0, canvas.dirty_y1);
+#elif defined(INVERT_DISPLAY)
+    /* The canvas is mirrored onto the panel, so just push all of it */
+    display_set_window(0, 0, canvas.width, canvas.height);
     display_prepare_gram_write();
 
     int num_writes = canvas.width * canvas.height;
 
-    int i;
-#ifdef INVERT_DISPLAY
-
-    for(i = num_writes; i > 0; i -= 2)
+    for(int i = num_writes; i > 0; i -= 2)
     {
         uint8_t v = (0xF0 & canvas.buffer[ i ]) | (canvas.buffer[ i - 1 ] >> 4);
+        display_write_ram(v);
+    }
 #else
+    /* Round out to whole display columns */
+    uint16_t x0 = canvas.dirty_x0 & ~3;
+    uint16_t x1 = (canvas.dirty_x1 + 3) & ~3;
+    uint16_t y0 = canvas.dirty_y0;
+    uint16_t y1 = canvas.dirty_y1;
 
-    for(i = 0; i < num_writes; i += 2)
+    display_set_window(x0, y0, x1, y1);
+    display_prepare_gram_write();
+
+    for(uint16_t y = y0; y < y1; y++)
     {
-        uint8_t v = (0xF0 & canvas.buffer[ i ]) | (canvas.buffer[ i + 1 ] >> 4);
-#endif
-        display_write_ram(v);
+        const uint8_t *row = &canvas.buffer[ y * canvas.width ];
+
+        for(uint16_t x = x0; x < x1; x += 2)
+        {
+            uint8_t v = (0xF0 & row[ x ]) | (row[ x + 1 ] >> 4);
+            display_write_ram(v);
+        }
     }
+#endif
 
     canvas.dirty = false;
 }
@@ -410,21 +459,7 @@ void display_hw_init(void)
     display_write_reg((uint8_t)0xA1);
     display_write_ram((uint8_t)0x00);
 
-
-    uint8_t row_start = START_ROW;
-    uint8_t row_end = row_start + 64 - 1;
-
-    /* Width is in units of 4 pixels/column (2 bytes at 4 bits/pixel) */
-    int width = (256 / 4);
-    uint8_t col_start = START_COL;
-    uint8_t col_end = col_start + width - 1;
-
-    display_write_reg((uint8_t)0x75);
-    display_write_ram(row_start);
-    display_write_ram(row_end);
-    display_write_reg((uint8_t)0x15);
-    display_write_ram(col_start);
-    display_write_ram(col_end);
+    display_set_window(0, 0, KEEPKEY_DISPLAY_WIDTH, KEEPKEY_DISPLAY_HEIGHT);
 
     /* Horizontal address increment */
     /* Disable colum address re-map */
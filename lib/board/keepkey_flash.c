@@ -24,6 +24,7 @@
 #else
 #   include <stdint.h>
 #   include <stdbool.h>
+#   include "keepkey/emulator/emulator.h"
 #endif
 
 #include "keepkey/board/supervise.h"
@@ -95,16 +96,18 @@ bool flash_chk_status(void)
  */
 void flash_erase_word(Allocation group)
 {
-#ifndef EMULATOR
     const FlashSector* s = flash_sector_map;
     while(s->use != FLASH_INVALID)
     {
         if(s->use == group) {
+#ifndef EMULATOR
             svc_flash_erase_sector((uint32_t)s->sector);
+#else
+            memset((void *)FLASH_PTR(s->start), 0xff, s->len);
+#endif
         }
         ++s;
     }
-#endif
 }
 
 
@@ -196,6 +199,25 @@ bool flash_write(Allocation group, uint32_t offset, uint32_t len, uint8_t* data)
 #endif
 }
 
+/*
+ * flash_sync() - Start writing the storage sectors back to the emulator's
+ * flash image.  A no-op on the device, where programming is already
+ * synchronous.
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void flash_sync(void)
+{
+#ifdef EMULATOR
+    intptr_t start = flash_write_helper(FLASH_STORAGE1);
+    intptr_t end = flash_write_helper(FLASH_STORAGE3) + FLASH_STORAGE_LEN;
+    emulatorFlashSync((const void *)start, end - start);
+#endif
+}
+
 /*
  * is_mfg_mode() - Is device in manufacture mode
  *
@@ -43,6 +43,10 @@ static Canvas *canvas = NULL;
 static volatile bool animate_flag = false;
 static leaving_handler_t leaving_handler;
 
+/* Delta-encoded animation currently on the canvas, and its last drawn frame */
+static const VariantAnimation *delta_animation = NULL;
+static int delta_frame = -1;
+
 /*
  *  layout_home_helper() - Splash home screen helper
  *
@@ -233,8 +237,11 @@ void layout_init(Canvas *new_canvas)
         animation_queue_push(&free_queue, &animations[ i ]);
     }
 
-    // Start the animation timer.
+#ifndef EMULATOR
+    // Start the animation timer.  On the device it stays posted: TIM4 walks
+    // the runnable queue from its interrupt, so it is not edited per animation.
     post_periodic(&layout_animate_callback, NULL, ANIMATION_PERIOD, ANIMATION_PERIOD);
+#endif
 }
 
 /*
@@ -350,7 +357,7 @@ void layout_notification_icon(NotificationType type, DrawableParams *sp)
             const VariantAnimation *anim = get_confirming_animation();
 
             layout_add_animation(
-                &layout_animate_images,
+                &layout_animate_delta_images,
                 (void *)anim,
                 get_image_animation_duration(anim));
             break;
@@ -537,8 +544,8 @@ void layout_loading(void)
     layout_clear();
 
     layout_add_animation(
-            &layout_animate_images, 
-            (void *)loading_animation, 
+            &layout_animate_delta_images,
+            (void *)loading_animation,
             0);
     force_animation_start();
 }
@@ -579,6 +586,13 @@ void animate(void)
         }
 
         animate_flag = false;
+
+#ifdef EMULATOR
+        if(animation_queue_peek(&active_queue) == NULL)
+        {
+            remove_runnable(&layout_animate_callback);
+        }
+#endif
     }
 }
 
@@ -627,6 +641,47 @@ void layout_animate_images(void *data, uint32_t duration, uint32_t elapsed)
     }
 }
 
+/*
+ * layout_animate_delta_images() - Animate a delta-encoded image on display
+ *
+ *     Frame 0 of the animation is drawn in full, and each later frame only
+ *     covers the region that changed since the frame before it. Frames that
+ *     were skipped over are applied in order, and the keyframe is redrawn
+ *     whenever the animation starts over.
+ *
+ * INPUT
+ *     - data: pointer to animation
+ *     - duration: duration of the image animation
+ *     - elapsed: delay before drawing the image
+ * OUTPUT
+ *     none
+ */
+void layout_animate_delta_images(void *data, uint32_t duration, uint32_t elapsed)
+{
+    const VariantAnimation *animation = (const VariantAnimation *)data;
+
+    bool looping = duration == 0;
+    int frameNum = get_image_animation_frame(animation, elapsed, looping);
+
+    if(frameNum == -1 || frameNum >= animation->count)
+    {
+        return;
+    }
+
+    if(animation != delta_animation || frameNum < delta_frame)
+    {
+        draw_bitmap_mono_rle(canvas, &animation->frames[0], false);
+        delta_animation = animation;
+        delta_frame = 0;
+    }
+
+    while(delta_frame < frameNum)
+    {
+        delta_frame++;
+        draw_bitmap_mono_rle(canvas, &animation->frames[delta_frame], false);
+    }
+}
+
 #if DEBUG_LINK
 static void layout_debuglink_watermark(void) {
     const Font *font = get_body_font();
@@ -720,6 +775,15 @@ void animating_progress_handler(void)
  */
 void layout_add_animation(AnimateCallback callback, void *data, uint32_t duration)
 {
+#ifdef EMULATOR
+    // Only tick the animation timer while there is something to animate, so
+    // an idle emulator is not woken every ANIMATION_PERIOD.
+    if(animation_queue_peek(&active_queue) == NULL)
+    {
+        post_periodic(&layout_animate_callback, NULL, ANIMATION_PERIOD, ANIMATION_PERIOD);
+    }
+#endif
+
     Animation *animation = animation_queue_get(&active_queue, callback);
 
     if(animation == NULL)
@@ -732,6 +796,10 @@ void layout_add_animation(AnimateCallback callback, void *data, uint32_t duratio
     animation->elapsed = 0;
     animation->animate_callback = callback;
     animation_queue_push(&active_queue, animation);
+
+    /* The canvas may have changed under any delta animation, so redraw
+     * from its keyframe */
+    delta_animation = NULL;
 }
 
 /*
@@ -751,6 +819,11 @@ void layout_clear_animations(void)
         animation_queue_push(&free_queue, animation);
         animation = animation_queue_pop(&active_queue);
     }
+
+#ifdef EMULATOR
+    remove_runnable(&layout_animate_callback);
+#endif
+    delta_animation = NULL;
 }
 
 /*
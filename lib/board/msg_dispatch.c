@@ -35,6 +35,7 @@
 
 static const MessagesMap_t *MessagesMap = NULL;
 static size_t map_size = 0;
+static bool map_is_mfr = false;
 static msg_failure_t msg_failure;
 
 #if DEBUG_LINK
@@ -46,6 +47,29 @@ static bool msg_tiny_flag = false;
 static CONFIDENTIAL uint8_t msg_tiny[MSG_TINY_BFR_SZ];
 static uint16_t msg_tiny_id = MSG_TINY_TYPE_ERROR; /* Default to error type */
 
+/* Framing state of the message currently being received */
+static TrezorFrameHeaderFirst last_frame_header = { .id = 0xffff, .len = 0 };
+static const MessagesMap_t *last_frame_entry = NULL;
+static size_t content_pos = 0;
+static bool mid_frame = false;
+
+/* Longest the decoder waits for the host to send the next segment */
+#define SEGMENT_STREAM_TIMEOUT_MS 1000
+
+/* Message being decoded straight out of the incoming segments.  Each segment
+ * is copied in, since the caller's UsbMessage is gone by the time the decoder
+ * gets to read it. */
+static struct
+{
+    bool active;
+    MessageMapType type;
+    volatile bool waiting;
+    uint8_t segment[USB_SEGMENT_SIZE];
+    const uint8_t *contents;
+    size_t available;
+    size_t remaining;
+} segment_stream;
+
 /* === Variables =========================================================== */
 
 /* Allow mapped messages to reset message stack.  This variable by itself doesn't
@@ -77,9 +101,9 @@ static const MessagesMap_t *message_map_entry(MessageMapType type,
     {
         switch (m[msg_id].msg_perms) {
         case MFROnly:
-            return variant_isMFR() ? &m[msg_id] : NULL;
+            return map_is_mfr ? &m[msg_id] : NULL;
         case MFRProhibited:
-            return variant_isMFR() ? NULL : &m[msg_id];
+            return map_is_mfr ? NULL : &m[msg_id];
         case AnyVariant:
             return &m[msg_id];
         }
@@ -120,7 +144,8 @@ static const pb_field_t *message_fields(MessageMapType type, MessageType msg_id,
 }
 
 /*
- * usb_write_pb() - Add usb frame header info to message buffer and perform usb transmission
+ * usb_write_pb_buffered() - Encode the whole message into a frame buffer and
+ * hand it to the transport in one go
  *
  * INPUT
  *     - fields: protocol buffer
@@ -130,11 +155,9 @@ static const pb_field_t *message_fields(MessageMapType type, MessageType msg_id,
  * OUTPUT
  *     none
  */
-static void usb_write_pb(const pb_field_t *fields, const void *msg, MessageType id,
-                         usb_tx_handler_t usb_tx_handler)
+static void usb_write_pb_buffered(const pb_field_t *fields, const void *msg,
+                                  MessageType id, usb_tx_handler_t usb_tx_handler)
 {
-    assert(fields != NULL);
-
     TrezorFrameBuffer framebuf;
     memset(&framebuf, 0, sizeof(framebuf));
     framebuf.frame.usb_header.hid_type = '?';
@@ -152,81 +175,317 @@ static void usb_write_pb(const pb_field_t *fields, const void *msg, MessageType
     }
 }
 
+/* Outgoing segment being filled by the streaming encoder */
+typedef struct
+{
+    uint8_t buf[USB_SEGMENT_SIZE];
+    size_t pos;
+    usb_tx_handler_t usb_tx_handler;
+} SegmentWriter;
+
 /*
- * pb_parse() - Process USB message by protocol buffer
+ * segment_writer_flush() - Transmit the current segment and start a new
+ * continuation segment
  *
  * INPUT
- *     - entry: pointer to message entry
- *     - msg: pointer to received message buffer
- *     - msg_size: size of message
- *     - buf: pointer to destination buffer
+ *     - writer: segment writer
  * OUTPUT
- *     true/false whether protocol buffers were parsed successfully
+ *     none
  */
-static bool pb_parse(const MessagesMap_t *entry, uint8_t *msg, uint32_t msg_size,
-                     uint8_t *buf)
+static void segment_writer_flush(SegmentWriter *writer)
 {
-    pb_istream_t stream = pb_istream_from_buffer(msg, msg_size);
-    return(pb_decode(&stream, entry->fields, buf));
+    (*writer->usb_tx_handler)(writer->buf, sizeof(writer->buf));
+
+    memset(writer->buf, 0, sizeof(writer->buf));
+    writer->buf[0] = '?';
+    writer->pos = 1;
 }
 
 /*
- * dispatch() - Process received message and jump to corresponding process function
+ * segment_writer_write() - nanopb output stream callback that packs encoded
+ * bytes into USB segments, transmitting each one as soon as it is full
  *
  * INPUT
- *     - entry: pointer to message entry
- *     - msg: pointer to received message buffer
- *     - msg_size: size of message
+ *     - stream: pointer to the output stream
+ *     - buf: bytes to write
+ *     - count: number of bytes to write
  * OUTPUT
- *     none
- *
+ *     true/false whether the bytes could be written
  */
-static void dispatch(const MessagesMap_t *entry, uint8_t *msg, uint32_t msg_size)
+static bool segment_writer_write(pb_ostream_t *stream, const uint8_t *buf, size_t count)
 {
-    static CONFIDENTIAL uint8_t decode_buffer[MAX_DECODE_SIZE] __attribute__((aligned(4)));
-    memset(decode_buffer, 0, sizeof(decode_buffer));
+    SegmentWriter *writer = (SegmentWriter *)stream->state;
 
-    if(pb_parse(entry, msg, msg_size, decode_buffer))
+    while(count > 0)
     {
-        if(entry->process_func)
-        {
-            entry->process_func(decode_buffer);
-        }
-        else
+        size_t len = sizeof(writer->buf) - writer->pos;
+        len = count < len ? count : len;
+
+        memcpy(writer->buf + writer->pos, buf, len);
+        writer->pos += len;
+        buf += len;
+        count -= len;
+
+        if(writer->pos == sizeof(writer->buf))
         {
-            (*msg_failure)(FailureType_Failure_UnexpectedMessage, "Unexpected message");
+            segment_writer_flush(writer);
         }
     }
+
+    return(true);
+}
+
+/*
+ * usb_write_pb_segmented() - Encode the message straight into USB segments,
+ * without staging the whole frame in RAM
+ *
+ * INPUT
+ *     - fields: protocol buffer
+ *     - msg: pointer to message buffer
+ *     - id: message id
+ *     - usb_tx_handler: handler to use to write data to usb endport
+ * OUTPUT
+ *     none
+ */
+static void usb_write_pb_segmented(const pb_field_t *fields, const void *msg,
+                                   MessageType id, usb_tx_handler_t usb_tx_handler)
+{
+    /* The frame header carries the length, so size the message up front */
+    size_t len;
+    if(!pb_get_encoded_size(&len, fields, msg) || len > MAX_FRAME_SIZE)
+    {
+        return;
+    }
+
+    SegmentWriter writer;
+    memset(&writer, 0, sizeof(writer));
+    writer.usb_tx_handler = usb_tx_handler;
+
+    TrezorFrame *frame = (TrezorFrame *)writer.buf;
+    frame->usb_header.hid_type = '?';
+    frame->header.pre1 = '#';
+    frame->header.pre2 = '#';
+    frame->header.id = __builtin_bswap16(id);
+    frame->header.len = __builtin_bswap32(len);
+    writer.pos = sizeof(TrezorFrame);
+
+    pb_ostream_t os = {
+        .callback = &segment_writer_write,
+        .state = &writer,
+        .max_size = len,
+        .bytes_written = 0,
+    };
+
+    if(pb_encode(&os, fields, msg) && writer.pos > 1)
+    {
+        segment_writer_flush(&writer);
+    }
+}
+
+/*
+ * usb_write_pb() - Add usb frame header info to message buffer and perform usb transmission
+ *
+ * INPUT
+ *     - fields: protocol buffer
+ *     - msg: pointer to message buffer
+ *     - id: message id
+ *     - usb_tx_handler: handler to use to write data to usb endport
+ * OUTPUT
+ *     none
+ */
+static void usb_write_pb(const pb_field_t *fields, const void *msg, MessageType id,
+                         usb_tx_handler_t usb_tx_handler)
+{
+    assert(fields != NULL);
+
+    /* U2F wraps the whole response in its own framing, so it needs the
+     * complete message up front */
+    if(usb_is_u2f_transport())
+    {
+        usb_write_pb_buffered(fields, msg, id, usb_tx_handler);
+    }
     else
     {
-        (*msg_failure)(FailureType_Failure_UnexpectedMessage,
-                       "Could not parse protocol buffer message");
+        usb_write_pb_segmented(fields, msg, id, usb_tx_handler);
+    }
+}
+
+static void segment_stream_abort(void);
+static void frame_reset(void);
+
+/*
+ * segment_stream_read() - nanopb input stream callback that reads message
+ * content straight out of the USB segments as they arrive, pulling in further
+ * segments from the host as needed.
+ *
+ * INPUT
+ *     - stream: pointer to the input stream
+ *     - buf: pointer to destination buffer
+ *     - count: number of bytes to read
+ * OUTPUT
+ *     true/false whether the bytes could be read
+ */
+static bool segment_stream_read(pb_istream_t *stream, uint8_t *buf, size_t count)
+{
+    (void)stream;
+
+    while(count > 0)
+    {
+        if(segment_stream.available == 0)
+        {
+            if(segment_stream.remaining == 0)
+            {
+                return(false);
+            }
+
+            /* Wait for usb_rx_helper() to hand over the next segment, but
+             * give up on a host that stalls mid-frame */
+            uint32_t start = timer_ticks();
+            segment_stream.waiting = true;
+            while(segment_stream.waiting)
+            {
+                usb_poll();
+#ifdef EMULATOR
+                timer_advance();
+#endif
+
+                if(segment_stream.waiting &&
+                        timer_ticks() - start > SEGMENT_STREAM_TIMEOUT_MS)
+                {
+                    segment_stream_abort();
+                    frame_reset();
+                }
+            }
+
+            if(segment_stream.available == 0)
+            {
+                return(false);
+            }
+        }
+
+        size_t len = count < segment_stream.available ? count : segment_stream.available;
+        memcpy(buf, segment_stream.contents, len);
+        segment_stream.contents += len;
+        segment_stream.available -= len;
+        buf += len;
+        count -= len;
     }
+
+    return(true);
+}
+
+/*
+ * segment_stream_push() - Hand a continuation segment to the waiting decoder
+ *
+ * INPUT
+ *     - contents: pointer to segment contents
+ *     - content_size: size of segment contents
+ * OUTPUT
+ *     none
+ */
+static void segment_stream_push(const uint8_t *contents, size_t content_size)
+{
+    size_t len = content_size < segment_stream.remaining ? content_size : segment_stream.remaining;
+    len = len < sizeof(segment_stream.segment) ? len : sizeof(segment_stream.segment);
+
+    memcpy(segment_stream.segment, contents, len);
+    segment_stream.contents = segment_stream.segment;
+    segment_stream.available = len;
+    segment_stream.remaining -= len;
+    segment_stream.waiting = false;
+}
+
+/*
+ * segment_stream_abort() - Make the waiting decoder (if any) fail
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+static void segment_stream_abort(void)
+{
+    segment_stream.contents = NULL;
+    segment_stream.available = 0;
+    segment_stream.remaining = 0;
+    segment_stream.waiting = false;
 }
 
 /*
- * tiny_dispatch() - Process received tiny messages
+ * stream_dispatch() - Decode a message as its segments arrive, then jump to
+ * the corresponding process function
  *
  * INPUT
+ *     - type: message map type (normal or debug)
  *     - entry: pointer to message entry
- *     - msg: pointer to received message buffer
- *     - msg_size: size of message
+ *     - contents: pointer to contents of the first segment
+ *     - content_size: size of contents of the first segment
+ *     - frame_length: total expected size
  * OUTPUT
  *     none
  *
  */
-static void tiny_dispatch(const MessagesMap_t *entry, uint8_t *msg, uint32_t msg_size)
+static void stream_dispatch(MessageMapType type, const MessagesMap_t *entry,
+                            const uint8_t *contents, size_t content_size,
+                            uint32_t frame_length)
 {
-    bool status = pb_parse(entry, msg, msg_size, msg_tiny);
+    static CONFIDENTIAL uint8_t decode_buffer[MAX_DECODE_SIZE] __attribute__((aligned(4)));
+    uint8_t *buf = decode_buffer;
+    bool tiny = msg_tiny_flag;
 
-    if(status)
+    if(tiny)
     {
-        msg_tiny_id = entry->msg_id;
+        buf = msg_tiny;
     }
     else
     {
-        call_msg_failure_handler(FailureType_Failure_UnexpectedMessage,
-                                 "Could not parse tiny protocol buffer message");
+        memset(decode_buffer, 0, sizeof(decode_buffer));
+    }
+
+    segment_stream.active = true;
+    segment_stream.type = type;
+    segment_stream.remaining = frame_length;
+    segment_stream_push(contents, content_size);
+
+    pb_istream_t stream = {
+        .callback = &segment_stream_read,
+        .state = NULL,
+        .bytes_left = frame_length,
+    };
+
+    bool status = pb_decode(&stream, entry->fields, buf);
+
+    /* Any segments the decoder didn't consume are drained by usb_rx_helper() */
+    segment_stream_abort();
+    segment_stream.active = false;
+
+    if(tiny)
+    {
+        if(status)
+        {
+            msg_tiny_id = entry->msg_id;
+        }
+        else
+        {
+            call_msg_failure_handler(FailureType_Failure_UnexpectedMessage,
+                                     "Could not parse tiny protocol buffer message");
+        }
+    }
+    else if(status)
+    {
+        if(entry->process_func)
+        {
+            entry->process_func(decode_buffer);
+        }
+        else
+        {
+            (*msg_failure)(FailureType_Failure_UnexpectedMessage, "Unexpected message");
+        }
+    }
+    else
+    {
+        (*msg_failure)(FailureType_Failure_UnexpectedMessage,
+                       "Could not parse protocol buffer message");
     }
 }
 
@@ -285,6 +544,43 @@ static void raw_dispatch(const MessagesMap_t *entry, uint8_t *msg, uint32_t msg_
     })
 #endif
 
+/*
+ * frame_reset() - Forget the message currently being received, so the next
+ * segment has to start a new frame
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+static void frame_reset(void)
+{
+    last_frame_header.id = 0xffff;
+    last_frame_header.len = 0;
+    last_frame_entry = NULL;
+    content_pos = 0;
+    mid_frame = false;
+}
+
+/*
+ * segment_ack() - Acknowledge a segment on the U2F transport
+ *
+ * INPUT
+ *     - contents: pointer to segment contents
+ * OUTPUT
+ *     none
+ */
+static void segment_ack(const uint8_t *contents)
+{
+    //the packetized u2f-injection device<->host protocol requires and ACK sent to be sent after every packet
+    if (usb_is_u2f_transport()){
+        //only send the ACK packet if the recvd message came in over the U2F transport
+        //TODO pass in debug link and set flag here to handle framed debuglink acks
+        uint8_t empty_report[] = {0x00, 0x00, 0x00, contents[1],0x00, 0x00, 0x00, 0x90, 0x00}; 
+        send_u2f_msg(empty_report, sizeof(empty_report));
+    }
+}
+
 /*
  * usb_rx_helper() - Common helper that handles USB messages from host
  *
@@ -296,17 +592,13 @@ static void raw_dispatch(const MessagesMap_t *entry, uint8_t *msg, uint32_t msg_
  */
 void usb_rx_helper(UsbMessage *msg, MessageMapType type)
 {
-    static TrezorFrameHeaderFirst last_frame_header = { .id = 0xffff, .len = 0 };
-    static uint8_t content_buf[MAX_FRAME_SIZE];
-    static size_t content_pos = 0, content_size = 0;
-    static bool mid_frame = false;
-
     const MessagesMap_t *entry;
     TrezorFrame *frame = (TrezorFrame *)(msg->message);
     TrezorFrameFragment *frame_fragment = (TrezorFrameFragment *)(msg->message);
 
-    bool last_segment;
+    bool first_segment, last_segment;
     uint8_t *contents;
+    size_t content_size;
 
     assert(msg != NULL);
 
@@ -315,6 +607,14 @@ void usb_rx_helper(UsbMessage *msg, MessageMapType type)
         goto done_handling;
     }
 
+    /* The framing state belongs to the message being decoded further up the
+     * stack, and nothing from the other interface can be dispatched until
+     * that decode returns, so drop it */
+    if(segment_stream.active && type != segment_stream.type)
+    {
+        goto done_handling;
+    }
+
     /* Check to see if this is the first frame of a series, * or a
        continuation/fragment.  */
     if(frame->header.pre1 == '#' && frame->header.pre2 == '#' && !mid_frame)
@@ -328,7 +628,10 @@ void usb_rx_helper(UsbMessage *msg, MessageMapType type)
         /* Init content pos and size */
         content_pos = msg->len - 9;
         content_size = content_pos;
+        first_segment = true;
 
+        /* Look up the map entry once per frame, rather than per segment */
+        last_frame_entry = message_map_entry(type, last_frame_header.id, IN_MSG);
     }
     else if(mid_frame)
     {
@@ -336,18 +639,33 @@ void usb_rx_helper(UsbMessage *msg, MessageMapType type)
         if (check_uadd_overflow(content_pos, (size_t)(msg->len - 1), &content_pos))
             goto reset;
         content_size = msg->len - 1;
+        first_segment = false;
     }
     else
     {
         contents = frame_fragment->contents;
         content_size = msg->len - 1;
+        first_segment = false;
+
+        last_frame_entry = message_map_entry(type, last_frame_header.id, IN_MSG);
     }
 
     last_segment = content_pos >= last_frame_header.len;
     mid_frame = !last_segment;
 
-    /* Determine callback handler and message map type */
-    entry = message_map_entry(type, last_frame_header.id, IN_MSG);
+    if(segment_stream.active && !first_segment)
+    {
+        /* A message is being decoded further up the stack, feed it */
+        segment_stream_push(contents, content_size);
+
+        if(!last_segment)
+        {
+            segment_ack(contents);
+        }
+        goto done_handling;
+    }
+
+    entry = last_frame_entry;
 
     if(entry && entry->dispatch == RAW)
     {
@@ -357,62 +675,38 @@ void usb_rx_helper(UsbMessage *msg, MessageMapType type)
          */
         raw_dispatch(entry, contents, content_size, last_frame_header.len);
     }
-    else if(entry)
+    else if(entry && first_segment)
     {
-        size_t offset, len;
-        if (content_size == content_pos) {
-            offset = 0;
-            len = content_size;
-        } else {
-            offset = content_pos - (msg->len - 1);
-            len = msg->len - 1;
-        }
-
-        size_t end;
-        if (check_uadd_overflow(offset, len, &end) || sizeof(content_buf) < end)
+        if(last_frame_header.len > MAX_FRAME_SIZE)
             goto reset;
 
-        /* Copy content to frame buffer */
-        memcpy(content_buf + offset, contents, len);
+        if(!last_segment)
+        {
+            segment_ack(contents);
+        }
+
+        /* Decode directly from this and the following segments, as they
+         * arrive, rather than staging the whole frame first */
+        stream_dispatch(type, entry, contents, content_size, last_frame_header.len);
+        goto done_handling;
+    }
+    else if(entry && last_segment)
+    {
+        /* Tail of a message whose decode already finished */
+        goto done_handling;
     }
 
-    /*
-     * Only parse and message map if all segments have been buffered
-     * and this message type is parsable
-     */
     if(last_segment && !entry)
     {
         (*msg_failure)(FailureType_Failure_UnexpectedMessage, "Unknown message");
     }
-    else if(last_segment && entry->dispatch != RAW)
-    {
-        if(msg_tiny_flag)
-        {
-            tiny_dispatch(entry, content_buf, last_frame_header.len);
-            goto done_handling;
-        }
-        else
-        {
-            dispatch(entry, content_buf, last_frame_header.len);
-            goto done_handling;
-        }
-    }
-    //the packetized u2f-injection device<->host protocol requires and ACK sent to be sent after every packet
-    if (usb_is_u2f_transport()){
-        //only send the ACK packet if the recvd message came in over the U2F transport
-        //TODO pass in debug link and set flag here to handle framed debuglink acks
-        uint8_t empty_report[] = {0x00, 0x00, 0x00, contents[1],0x00, 0x00, 0x00, 0x90, 0x00}; 
-        send_u2f_msg(empty_report, sizeof(empty_report));
-    }
+
+    segment_ack(contents);
     goto done_handling;
 
 reset:
-    last_frame_header.id = 0xffff;
-    last_frame_header.len = 0;
-    memset(content_buf, 0, sizeof(content_buf));
-    content_pos = 0;
-    content_size = 0;
-    mid_frame = false;
+    frame_reset();
+    segment_stream_abort();
 
 done_handling:
     return;
@@ -497,6 +791,9 @@ void msg_map_init(const void *map, const size_t size)
     assert(map != NULL);
     MessagesMap = map;
     map_size = size;
+
+    /* The variant can't change at runtime, so resolve permissions up front */
+    map_is_mfr = variant_isMFR();
 }
 
 /*
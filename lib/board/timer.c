@@ -26,6 +26,7 @@
 #  include <libopencm3/cm3/cortex.h>
 #else
 #  include <signal.h>
+#  include <time.h>
 #  include <unistd.h>
 #endif
 
@@ -38,10 +39,16 @@
 /* === Private Variables =================================================== */
 
 static volatile uint32_t remaining_delay = UINT32_MAX;
+static volatile uint32_t tick_count = 0;
 static RunnableNode runnables[MAX_RUNNABLES];
 static RunnableQueue free_queue = {NULL, 0};
 static RunnableQueue active_queue = {NULL, 0};
 
+#ifdef EMULATOR
+static uint64_t last_tick_ms;
+static uint64_t timer_clock_ms(void);
+#endif
+
 /* === Private Functions =================================================== */
 
 /*
@@ -225,6 +232,10 @@ void kk_timer_init(void)
     {
         runnable_queue_push(&free_queue, &runnables[ i ]);
     }
+
+#ifdef EMULATOR
+    last_tick_ms = timer_clock_ms();
+#endif
 }
 
 
@@ -331,6 +342,19 @@ void delay_ms_with_callback(uint32_t ms, callback_func_t callback_func,
     }
 }
 
+/*
+ * timer_ticks() - Ticks of the 1ms timer since boot, wrapping around
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     tick count
+ */
+uint32_t timer_ticks(void)
+{
+    return tick_count;
+}
+
 /*
  * timerisr_usr() - Timer 4 user mode interrupt service routine
  *
@@ -342,6 +366,8 @@ void delay_ms_with_callback(uint32_t ms, callback_func_t callback_func,
  */
 void timerisr_usr(void)
 {
+    tick_count++;
+
     /* Decrement the delay */
     if(remaining_delay > 0)
     {
@@ -359,6 +385,73 @@ void timerisr_usr(void)
 void tim4_sighandler(int sig) {
     timerisr_usr();
 }
+
+/*
+ * timer_clock_ms() - Monotonic host clock
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     milliseconds since an arbitrary fixed point
+ */
+static uint64_t timer_clock_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/*
+ * timer_next_deadline_ms() - Time until the next queued task is due
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     milliseconds until the soonest runnable fires, UINT32_MAX if none
+ */
+uint32_t timer_next_deadline_ms(void)
+{
+    uint32_t next = UINT32_MAX;
+
+    for(RunnableNode *node = runnable_queue_peek(&active_queue); node != NULL;
+            node = node->next)
+    {
+        if(node->remaining < next)
+        {
+            next = node->remaining;
+        }
+    }
+
+    return next;
+}
+
+/*
+ * timer_advance() - Run the 1ms ticks that have elapsed on the host clock
+ * since the last call.  The emulator has no tick interrupt, so its main loop
+ * drives the task manager through this.
+ *
+ * INPUT
+ *     none
+ * OUTPUT
+ *     none
+ */
+void timer_advance(void)
+{
+    uint64_t now = timer_clock_ms();
+
+    /* Start the clock here if kk_timer_init() never ran, rather than
+     * replaying every millisecond since the host booted */
+    if(last_tick_ms == 0)
+    {
+        last_tick_ms = now;
+    }
+
+    while(last_tick_ms < now)
+    {
+        last_tick_ms++;
+        timerisr_usr();
+    }
+}
 #endif
 
 /*
@@ -0,0 +1,100 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2018 KeepKey
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "keepkey/emulator/emulator.h"
+#include "keepkey/emulator/framebuffer.h"
+
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+static const char *framebuffer_name = NULL;
+static EmulatorFramebuffer *framebuffer = NULL;
+static bool framebuffer_failed = false;
+
+void emulatorSetFramebufferName(const char *name) {
+	framebuffer_name = name;
+}
+
+static EmulatorFramebuffer *framebuffer_open(uint16_t width, uint16_t height) {
+	const char *name = framebuffer_name;
+	if (name == NULL) {
+		name = getenv(EMULATOR_FRAMEBUFFER_ENV);
+	}
+	if (name == NULL || *name == '\0') {
+		return NULL;
+	}
+
+	size_t size = sizeof(EmulatorFramebuffer) + (size_t)width * height;
+
+	int fd = shm_open(name, O_RDWR | O_CREAT, 0644);
+	if (fd < 0) {
+		perror("Failed to open framebuffer shared memory");
+		return NULL;
+	}
+
+	if (ftruncate(fd, size) != 0) {
+		perror("Failed to size framebuffer shared memory");
+		close(fd);
+		return NULL;
+	}
+
+	EmulatorFramebuffer *fb = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (fb == MAP_FAILED) {
+		perror("Failed to map framebuffer shared memory");
+		return NULL;
+	}
+
+	memset(fb->pixels, 0, (size_t)width * height);
+	fb->width = width;
+	fb->height = height;
+	fb->reserved = 0;
+	__atomic_store_n(&fb->sequence, 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&fb->magic, EMULATOR_FRAMEBUFFER_MAGIC, __ATOMIC_RELEASE);
+	return fb;
+}
+
+void emulatorPublishFrame(const uint8_t *pixels, uint16_t width, uint16_t height,
+                          uint16_t y0, uint16_t y1) {
+	if (framebuffer == NULL) {
+		if (framebuffer_failed) {
+			return;
+		}
+		framebuffer = framebuffer_open(width, height);
+		if (framebuffer == NULL) {
+			framebuffer_failed = true;
+			return;
+		}
+	}
+
+	/* Only the dirty rows changed since the last frame */
+	uint32_t seq = framebuffer->sequence;
+	__atomic_store_n(&framebuffer->sequence, seq + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+
+	memcpy(&framebuffer->pixels[(size_t)y0 * width], &pixels[(size_t)y0 * width],
+	       (size_t)(y1 - y0) * width);
+
+	__atomic_store_n(&framebuffer->sequence, seq + 2, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,189 @@
+/*
+ * This file is part of the KeepKey project.
+ *
+ * Copyright (C) 2018 KeepKey
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "keepkey/emulator/emulator.h"
+#include "keepkey/emulator/inproc.h"
+
+#include <string.h>
+
+/* Stand-in for the UDP socket pair in udp.c: one queue of 64-byte reports per
+ * interface and direction. */
+
+#define INPROC_REPORT_SIZE 64
+#define INPROC_RX_REPORTS  256
+/* Room for the largest reply frame plus its continuation headers */
+#define INPROC_TX_REPORTS  2048
+
+struct inproc_report {
+	uint8_t len;
+	uint8_t data[INPROC_REPORT_SIZE];
+};
+
+struct inproc_ring {
+	struct inproc_report *slots;
+	size_t capacity;
+	size_t head;
+	size_t count;
+};
+
+static struct inproc_report rx_slots[2][INPROC_RX_REPORTS];
+static struct inproc_report tx_slots[2][INPROC_TX_REPORTS];
+
+static struct inproc_ring rx[2] = {
+	{ rx_slots[0], INPROC_RX_REPORTS, 0, 0 },
+	{ rx_slots[1], INPROC_RX_REPORTS, 0, 0 },
+};
+static struct inproc_ring tx[2] = {
+	{ tx_slots[0], INPROC_TX_REPORTS, 0, 0 },
+	{ tx_slots[1], INPROC_TX_REPORTS, 0, 0 },
+};
+
+static emulator_inproc_tx_hook_t tx_hook = NULL;
+static void *tx_hook_context = NULL;
+
+static bool ring_push(struct inproc_ring *ring, const void *buffer, size_t size) {
+	if (size > INPROC_REPORT_SIZE || ring->count == ring->capacity) {
+		return false;
+	}
+
+	struct inproc_report *slot = &ring->slots[(ring->head + ring->count) % ring->capacity];
+	slot->len = size;
+	memcpy(slot->data, buffer, size);
+	ring->count++;
+	return true;
+}
+
+static size_t ring_pop(struct inproc_ring *ring, void *buffer, size_t size) {
+	if (ring->count == 0) {
+		return 0;
+	}
+
+	struct inproc_report *slot = &ring->slots[ring->head];
+	size_t n = slot->len < size ? slot->len : size;
+	memcpy(buffer, slot->data, n);
+	ring->head = (ring->head + 1) % ring->capacity;
+	ring->count--;
+	return n;
+}
+
+static bool iface_valid(int iface) {
+	return iface == INPROC_IFACE_MAIN || iface == INPROC_IFACE_DEBUG;
+}
+
+void emulatorInprocReset(void) {
+	for (int i = 0; i < 2; i++) {
+		rx[i].head = rx[i].count = 0;
+		tx[i].head = tx[i].count = 0;
+	}
+}
+
+bool emulatorInprocSend(int iface, const void *report, size_t size) {
+	return iface_valid(iface) && ring_push(&rx[iface], report, size);
+}
+
+/* Frame a message the way a host does: an "##" header with the message id
+ * and payload length, split across '?'-prefixed reports.  Nothing is queued
+ * unless the whole frame fits. */
+bool emulatorInprocSendMessage(int iface, uint16_t id, const void *payload, uint32_t size) {
+	if (!iface_valid(iface)) {
+		return false;
+	}
+
+	const uint8_t header[8] = {
+		'#', '#',
+		(uint8_t)(id >> 8), (uint8_t)id,
+		(uint8_t)(size >> 24), (uint8_t)(size >> 16), (uint8_t)(size >> 8), (uint8_t)size,
+	};
+	size_t frame_size = sizeof(header) + (size_t)size;
+	size_t reports = (frame_size + INPROC_REPORT_SIZE - 2) / (INPROC_REPORT_SIZE - 1);
+	if (reports > rx[iface].capacity - rx[iface].count) {
+		return false;
+	}
+
+	const uint8_t *data = payload;
+	for (size_t pos = 0; pos < frame_size; pos += INPROC_REPORT_SIZE - 1) {
+		uint8_t report[INPROC_REPORT_SIZE] = { '?' };
+		for (size_t i = 0; i < INPROC_REPORT_SIZE - 1 && pos + i < frame_size; i++) {
+			size_t offset = pos + i;
+			report[1 + i] = offset < sizeof(header) ? header[offset] : data[offset - sizeof(header)];
+		}
+		ring_push(&rx[iface], report, sizeof(report));
+	}
+	return true;
+}
+
+size_t emulatorInprocPending(int iface) {
+	return iface_valid(iface) ? rx[iface].count : 0;
+}
+
+size_t emulatorInprocRecv(int iface, void *report, size_t size) {
+	return iface_valid(iface) ? ring_pop(&tx[iface], report, size) : 0;
+}
+
+/* A hook sees each report as the firmware sends it, which is the only way
+ * for the driver to answer a ButtonRequest while the firmware is blocked
+ * inside a confirm loop on the driver's own thread. */
+void emulatorInprocSetTxHook(emulator_inproc_tx_hook_t hook, void *context) {
+	tx_hook = hook;
+	tx_hook_context = context;
+}
+
+/* emulator.h host interface, backed by the queues above */
+
+void emulatorSetUdpPort(int port) {
+	(void)port;
+}
+
+void emulatorSocketInit(void) {
+	emulatorInprocReset();
+}
+
+size_t emulatorSocketRead(int *iface, void *buffer, size_t size) {
+	size_t n = ring_pop(&rx[INPROC_IFACE_MAIN], buffer, size);
+	if (n > 0) {
+		*iface = INPROC_IFACE_MAIN;
+		return n;
+	}
+
+	n = ring_pop(&rx[INPROC_IFACE_DEBUG], buffer, size);
+	if (n > 0) {
+		*iface = INPROC_IFACE_DEBUG;
+		return n;
+	}
+
+	return 0;
+}
+
+size_t emulatorSocketWrite(int iface, const void *buffer, size_t size) {
+	if (!iface_valid(iface)) {
+		return 0;
+	}
+
+	if (tx_hook != NULL) {
+		tx_hook(iface, buffer, size, tx_hook_context);
+		return size;
+	}
+
+	return ring_push(&tx[iface], buffer, size) ? size : 0;
+}
+
+bool emulatorSocketWait(int timeout_ms) {
+	(void)timeout_ms;
+	return rx[INPROC_IFACE_MAIN].count > 0 || rx[INPROC_IFACE_DEBUG].count > 0;
+}
@@ -19,10 +19,12 @@
 
 #include "keepkey/board/memory.h"
 #include "keepkey/board/timer.h"
+#include "keepkey/emulator/emulator.h"
 #include "keepkey/rand/rng.h"
 
 #include <errno.h>
 #include <fcntl.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -30,14 +32,38 @@
 #include <unistd.h>
 
 #define EMULATOR_FLASH_FILE "emulator.img"
+#define EMULATOR_FLASH_FILE_ENV "KEEPKEY_FLASH_FILE"
+/* Flash path that keeps the image in anonymous memory, never touching disk */
+#define EMULATOR_FLASH_MEMORY ":memory:"
 
 uint32_t __stack_chk_guard;
 
 static int urandom = -1;
+static const char *flash_path = NULL;
+static bool flash_in_memory = false;
 
 static void setup_urandom(void);
 static void setup_flash(void);
 
+/* Flash image backing this instance. Set explicitly, or from
+ * $KEEPKEY_FLASH_FILE, or emulator.img in the working directory. */
+void emulatorSetFlashPath(const char *path) {
+	flash_path = path;
+}
+
+static const char *flash_file(void) {
+	if (flash_path != NULL) {
+		return flash_path;
+	}
+
+	const char *env = getenv(EMULATOR_FLASH_FILE_ENV);
+	if (env != NULL && *env != '\0') {
+		return env;
+	}
+
+	return EMULATOR_FLASH_FILE;
+}
+
 void setup(void) {
 	setup_urandom();
 	setup_flash();
@@ -60,7 +86,23 @@ static void setup_urandom(void) {
 }
 
 static void setup_flash(void) {
-	int fd = open(EMULATOR_FLASH_FILE, O_RDWR | O_SYNC | O_CREAT, 0644);
+	const char *path = flash_file();
+
+	if (strcmp(path, EMULATOR_FLASH_MEMORY) == 0) {
+		emulator_flash_base = mmap(NULL, FLASH_TOTAL_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (emulator_flash_base == MAP_FAILED) {
+			perror("Failed to map flash emulation memory");
+			exit(1);
+		}
+
+		flash_in_memory = true;
+		memset(emulator_flash_base, 0xff, FLASH_TOTAL_SIZE);
+		return;
+	}
+
+	/* Flash stores go straight into the shared mapping, so O_SYNC on the
+	 * descriptor would never apply to them */
+	int fd = open(path, O_RDWR | O_CREAT, 0644);
 	if (fd < 0) {
 		perror("Failed to open flash emulation file");
 		exit(1);
@@ -86,5 +128,23 @@ static void setup_flash(void) {
 
 		/* Initialize the flash */
 		memset(emulator_flash_base, 0xff, FLASH_TOTAL_SIZE);
+		emulatorFlashSync(emulator_flash_base, FLASH_TOTAL_SIZE);
+	}
+}
+
+/* Start writing back the pages of the image that cover [addr, addr + len).
+ * This doesn't wait for the disk: stores already sit in the shared page
+ * cache, where they survive the process. */
+void emulatorFlashSync(const void *addr, size_t len) {
+	if (flash_in_memory || emulator_flash_base == NULL) {
+		return;
+	}
+
+	uintptr_t page = sysconf(_SC_PAGESIZE);
+	uintptr_t start = (uintptr_t)addr & ~(page - 1);
+	uintptr_t end = (uintptr_t)addr + len;
+
+	if (msync((void *)start, end - start, MS_ASYNC) != 0) {
+		perror("Failed to sync flash emulation file");
 	}
 }
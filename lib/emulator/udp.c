@@ -19,12 +19,15 @@
 
 #include <arpa/inet.h>
 #include <errno.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/epoll.h>
 #include <sys/socket.h>
 
 #define TREZOR_UDP_PORT 21324
+#define TREZOR_UDP_PORT_ENV "KEEPKEY_UDP_PORT"
 
 struct usb_socket {
 	int fd;
@@ -34,6 +37,8 @@ struct usb_socket {
 
 static struct usb_socket usb_main;
 static struct usb_socket usb_debug;
+static int usb_epoll = -1;
+static int udp_port = 0;
 
 static int socket_setup(int port) {
 	int fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
@@ -56,6 +61,18 @@ static int socket_setup(int port) {
 	return fd;
 }
 
+static void socket_watch(struct usb_socket *sock) {
+	struct epoll_event ev;
+	memset(&ev, 0, sizeof(ev));
+	ev.events = EPOLLIN;
+	ev.data.ptr = sock;
+
+	if (epoll_ctl(usb_epoll, EPOLL_CTL_ADD, sock->fd, &ev) != 0) {
+		perror("Failed to watch socket");
+		exit(1);
+	}
+}
+
 static size_t socket_write(struct usb_socket *sock, const void *buffer, size_t size) {
 	if (sock->fromlen > 0) {
 		ssize_t n = sendto(sock->fd, buffer, size, MSG_DONTWAIT, (const struct sockaddr *) &sock->from, sock->fromlen);
@@ -90,11 +107,62 @@ static size_t socket_read(struct usb_socket *sock, void *buffer, size_t size) {
 	return n;
 }
 
+/* Main interface port; the debug link listens on the next one up. Set
+ * explicitly, or from $KEEPKEY_UDP_PORT, or the TREZOR default. */
+void emulatorSetUdpPort(int port) {
+	udp_port = port;
+}
+
+static int socket_port(void) {
+	if (udp_port > 0) {
+		return udp_port;
+	}
+
+	const char *env = getenv(TREZOR_UDP_PORT_ENV);
+	if (env != NULL && *env != '\0') {
+		char *end;
+		long port = strtol(env, &end, 10);
+		if (*end != '\0' || port <= 0 || port >= 65535) {
+			fprintf(stderr, "Invalid %s: %s\n", TREZOR_UDP_PORT_ENV, env);
+			exit(1);
+		}
+		return port;
+	}
+
+	return TREZOR_UDP_PORT;
+}
+
 void emulatorSocketInit(void) {
-	usb_main.fd = socket_setup(TREZOR_UDP_PORT);
+	int port = socket_port();
+
+	usb_main.fd = socket_setup(port);
 	usb_main.fromlen = 0;
-	usb_debug.fd = socket_setup(TREZOR_UDP_PORT + 1);
+	usb_debug.fd = socket_setup(port + 1);
 	usb_debug.fromlen = 0;
+
+	usb_epoll = epoll_create1(EPOLL_CLOEXEC);
+	if (usb_epoll < 0) {
+		perror("Failed to create epoll instance");
+		exit(1);
+	}
+	socket_watch(&usb_main);
+	socket_watch(&usb_debug);
+}
+
+/* Sleep until a datagram is waiting on either interface, or timeout_ms
+ * milliseconds pass (-1 waits forever). Returns true if a read would not
+ * block. */
+bool emulatorSocketWait(int timeout_ms) {
+	struct epoll_event ev[2];
+	int n = epoll_wait(usb_epoll, ev, 2, timeout_ms);
+	if (n < 0) {
+		if (errno != EINTR) {
+			perror("Failed to wait on sockets");
+		}
+		return false;
+	}
+
+	return n > 0;
 }
 
 size_t emulatorSocketRead(int *iface, void *buffer, size_t size) {
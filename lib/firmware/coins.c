@@ -195,65 +195,174 @@ bool bip32_path_to_string(char *str, size_t len, const uint32_t *address_n,
     return true;
 }
 
-const CoinType *coinByShortcut(const char *shortcut)
+/* Secondary indices over coins[], built on first use */
+typedef int (*coin_key_cmp_t)(const void *key, const CoinType *coin);
+
+static uint8_t coins_by_shortcut[COINS_COUNT];
+static uint8_t coins_by_name[COINS_COUNT];
+static uint8_t coins_by_address_type[COINS_COUNT];
+static uint8_t coins_by_slip44[COINS_COUNT];
+static bool coins_indexed = false;
+
+_Static_assert(COINS_COUNT <= UINT8_MAX, "coin index too narrow");
+
+static int coin_shortcut_cmp(const void *key, const CoinType *coin)
 {
-    if(!shortcut) { return 0; }
+    return strncasecmp((const char *)key, coin->coin_shortcut,
+                       sizeof(coin->coin_shortcut));
+}
 
-    int i;
+static int coin_name_cmp(const void *key, const CoinType *coin)
+{
+    return strncasecmp((const char *)key, coin->coin_name,
+                       sizeof(coin->coin_name));
+}
+
+static int coin_address_type_cmp(const void *key, const CoinType *coin)
+{
+    uint32_t address_type = *(const uint32_t *)key;
+    if(address_type == coin->address_type) { return 0; }
+    return address_type < coin->address_type ? -1 : 1;
+}
+
+static int coin_slip44_cmp(const void *key, const CoinType *coin)
+{
+    uint32_t bip44_account_path = *(const uint32_t *)key;
+    if(bip44_account_path == coin->bip44_account_path) { return 0; }
+    return bip44_account_path < coin->bip44_account_path ? -1 : 1;
+}
+
+/*
+ * coin_index_sort() - Insertion sort an index by the given key, keeping
+ * table order among equal keys so that lookups still return the first match
+ *
+ * INPUT
+ *     - index: index to sort
+ *     - key_of: returns the key of a coin, in the form cmp expects
+ *     - cmp: key comparison
+ * OUTPUT
+ *     none
+ */
+static void coin_index_sort(uint8_t *index, const void *(*key_of)(const CoinType *),
+                            coin_key_cmp_t cmp)
+{
+    int i, j;
 
     for(i = 0; i < COINS_COUNT; i++)
     {
-        if(strncasecmp(shortcut, coins[i].coin_shortcut,
-                       sizeof(coins[i].coin_shortcut)) == 0)
+        index[i] = i;
+    }
+
+    for(i = 1; i < COINS_COUNT; i++)
+    {
+        uint8_t cur = index[i];
+        const void *key = key_of(&coins[cur]);
+
+        for(j = i; j > 0 && cmp(key, &coins[index[j - 1]]) < 0; j--)
         {
-            return &coins[i];
+            index[j] = index[j - 1];
         }
+
+        index[j] = cur;
     }
+}
 
-    return 0;
+static const void *coin_shortcut_key(const CoinType *coin)
+{
+    return coin->coin_shortcut;
 }
 
-const CoinType *coinByName(const char *name)
+static const void *coin_name_key(const CoinType *coin)
 {
-    if(!name) { return 0; }
+    return coin->coin_name;
+}
 
-    int i;
+static const void *coin_address_type_key(const CoinType *coin)
+{
+    return &coin->address_type;
+}
 
-    for(i = 0; i < COINS_COUNT; i++)
-    {
-        if(strncasecmp(name, coins[i].coin_name,
-                       sizeof(coins[i].coin_name)) == 0)
-        {
-            return &coins[i];
-        }
-    }
+static const void *coin_slip44_key(const CoinType *coin)
+{
+    return &coin->bip44_account_path;
+}
 
-    return 0;
+static void coin_build_index(void)
+{
+    if(coins_indexed) { return; }
+
+    coin_index_sort(coins_by_shortcut, coin_shortcut_key, coin_shortcut_cmp);
+    coin_index_sort(coins_by_name, coin_name_key, coin_name_cmp);
+    coin_index_sort(coins_by_address_type, coin_address_type_key,
+                    coin_address_type_cmp);
+    coin_index_sort(coins_by_slip44, coin_slip44_key, coin_slip44_cmp);
+
+    coins_indexed = true;
 }
 
-const CoinType *coinByAddressType(uint32_t address_type)
+/*
+ * coin_index_find() - Binary search an index for the first coin matching key
+ *
+ * INPUT
+ *     - index: sorted index
+ *     - key: key to look for
+ *     - cmp: key comparison the index was sorted with
+ * OUTPUT
+ *     matching coin, or NULL
+ */
+static const CoinType *coin_index_find(const uint8_t *index, const void *key,
+                                       coin_key_cmp_t cmp)
 {
-    int i;
+    size_t lo = 0, hi = COINS_COUNT;
 
-    for(i = 0; i < COINS_COUNT; i++)
+    coin_build_index();
+
+    while(lo < hi)
     {
-        if(address_type == coins[i].address_type)
+        size_t mid = lo + (hi - lo) / 2;
+
+        if(cmp(key, &coins[index[mid]]) > 0)
         {
-            return &coins[i];
+            lo = mid + 1;
         }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    if(lo < COINS_COUNT && cmp(key, &coins[index[lo]]) == 0)
+    {
+        return &coins[index[lo]];
     }
 
     return 0;
 }
 
+const CoinType *coinByShortcut(const char *shortcut)
+{
+    if(!shortcut) { return 0; }
+
+    return coin_index_find(coins_by_shortcut, shortcut, coin_shortcut_cmp);
+}
+
+const CoinType *coinByName(const char *name)
+{
+    if(!name) { return 0; }
+
+    return coin_index_find(coins_by_name, name, coin_name_cmp);
+}
+
+const CoinType *coinByAddressType(uint32_t address_type)
+{
+    return coin_index_find(coins_by_address_type, &address_type,
+                           coin_address_type_cmp);
+}
+
 const CoinType *coinBySlip44(uint32_t bip44_account_path)
 {
-    for (int i = 0; i < COINS_COUNT; i++) {
-        if (bip44_account_path == coins[i].bip44_account_path) {
-            return &coins[i];
-        }
-    }
-    return 0;
+    return coin_index_find(coins_by_slip44, &bip44_account_path,
+                           coin_slip44_cmp);
 }
 
 /*
@@ -35,6 +35,24 @@
 
 #include <string.h>
 
+#define DERIVATION_CACHE_SIZE  8
+#define DERIVATION_CACHE_DEPTH 3 /* m / purpose' / coin_type' / account' */
+
+/// Session cache of intermediate (account-level) nodes, keyed by the root
+/// they were derived from and the path prefix leading to them.
+static CONFIDENTIAL struct {
+	bool set;
+	uint32_t last_used;
+	const curve_info *curve;
+	uint8_t root_chain_code[32];
+	size_t depth;
+	uint32_t address_n[DERIVATION_CACHE_DEPTH];
+	HDNode node;
+} derivation_cache[DERIVATION_CACHE_SIZE];
+
+static uint32_t derivation_cache_clock;
+static uint32_t derivation_cache_hits, derivation_cache_misses;
+
 uint32_t ser_length(uint32_t len, uint8_t *out)
 {
 	if (len < 253) {
@@ -341,3 +359,87 @@ int cryptoIdentityFingerprint(const IdentityType *identity, uint8_t *hash)
 	sha256_Final(&ctx, hash);
 	return 1;
 }
+
+void cryptoClearDerivationCache(void)
+{
+	memzero(derivation_cache, sizeof(derivation_cache));
+	derivation_cache_clock = 0;
+	derivation_cache_hits = 0;
+	derivation_cache_misses = 0;
+}
+
+void cryptoGetDerivationCacheStats(uint32_t *hits, uint32_t *misses)
+{
+	if (hits) *hits = derivation_cache_hits;
+	if (misses) *misses = derivation_cache_misses;
+}
+
+static int derivation_cache_find(const HDNode *root, const uint32_t *address_n, size_t depth)
+{
+	for (int j = 0; j < DERIVATION_CACHE_SIZE; j++) {
+		if (derivation_cache[j].set &&
+		    derivation_cache[j].depth == depth &&
+		    derivation_cache[j].curve == root->curve &&
+		    memcmp(derivation_cache[j].address_n, address_n, depth * sizeof(uint32_t)) == 0 &&
+		    memcmp(derivation_cache[j].root_chain_code, root->chain_code, sizeof(root->chain_code)) == 0) {
+			return j;
+		}
+	}
+	return -1;
+}
+
+static int derivation_cache_victim(void)
+{
+	int victim = 0;
+	for (int j = 0; j < DERIVATION_CACHE_SIZE; j++) {
+		if (!derivation_cache[j].set) {
+			return j;
+		}
+		if (derivation_cache[j].last_used < derivation_cache[victim].last_used) {
+			victim = j;
+		}
+	}
+	return victim;
+}
+
+int cryptoDeriveNodeCached(HDNode *inout, const uint32_t *address_n, size_t address_n_count, uint32_t *fingerprint)
+{
+	if (address_n_count == 0) {
+		return 1;
+	}
+
+	// Always leave at least one step for hdnode_private_ckd_cached, so that
+	// it can compute the parent fingerprint.
+	size_t depth = address_n_count - 1;
+	if (depth > DERIVATION_CACHE_DEPTH) {
+		depth = DERIVATION_CACHE_DEPTH;
+	}
+
+	if (depth > 0) {
+		int j = derivation_cache_find(inout, address_n, depth);
+		if (j >= 0) {
+			derivation_cache_hits++;
+			memcpy(inout, &derivation_cache[j].node, sizeof(HDNode));
+		} else {
+			derivation_cache_misses++;
+			j = derivation_cache_victim();
+			memzero(&derivation_cache[j], sizeof(derivation_cache[j]));
+			derivation_cache[j].curve = inout->curve;
+			memcpy(derivation_cache[j].root_chain_code, inout->chain_code,
+			       sizeof(derivation_cache[j].root_chain_code));
+			for (size_t k = 0; k < depth; k++) {
+				if (hdnode_private_ckd(inout, address_n[k]) == 0) {
+					memzero(&derivation_cache[j], sizeof(derivation_cache[j]));
+					return 0;
+				}
+			}
+			derivation_cache[j].depth = depth;
+			memcpy(derivation_cache[j].address_n, address_n, depth * sizeof(uint32_t));
+			memcpy(&derivation_cache[j].node, inout, sizeof(HDNode));
+			derivation_cache[j].set = true;
+		}
+		derivation_cache[j].last_used = ++derivation_cache_clock;
+	}
+
+	return hdnode_private_ckd_cached(inout, address_n + depth, address_n_count - depth, fingerprint);
+}
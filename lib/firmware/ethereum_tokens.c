@@ -2,6 +2,7 @@
 
 #include "keepkey/firmware/coins.h"
 
+#include <stdlib.h>
 #include <string.h>
 
 const TokenType tokens[] = {
@@ -810,14 +811,89 @@ _Static_assert(sizeof(tokens) / sizeof(tokens[0]) == TOKENS_COUNT,
 
 const TokenType *UnknownToken = (const TokenType *)1;
 
+// Lookup indices over tokens[], sorted by (chain_id, address) and by
+// (chain_id, ticker) respectively. Built on first use.
+static uint16_t tokens_by_address[TOKENS_COUNT];
+static uint16_t tokens_by_ticker[TOKENS_COUNT];
+static bool tokens_indexed = false;
+
+_Static_assert(TOKENS_COUNT <= UINT16_MAX, "token index too narrow");
+
+static int tokenAddressCmp(uint8_t chain_id, const uint8_t *address,
+                           const TokenType *token)
+{
+	if (chain_id != token->chain_id)
+		return chain_id < token->chain_id ? -1 : 1;
+	return memcmp(address, token->address, 20);
+}
+
+static int tokenTickerCmp(uint8_t chain_id, const char *ticker,
+                          const TokenType *token)
+{
+	if (chain_id != token->chain_id)
+		return chain_id < token->chain_id ? -1 : 1;
+	return strcmp(ticker, token->ticker + 1);
+}
+
+static int tokenIndexAddressCmp(const void *a, const void *b)
+{
+	const TokenType *lhs = &tokens[*(const uint16_t *)a];
+	const TokenType *rhs = &tokens[*(const uint16_t *)b];
+	int cmp = tokenAddressCmp(lhs->chain_id, (const uint8_t *)lhs->address, rhs);
+	if (cmp)
+		return cmp;
+	// Keep table order among duplicates, so the first match wins as before.
+	return (int)*(const uint16_t *)a - (int)*(const uint16_t *)b;
+}
+
+static int tokenIndexTickerCmp(const void *a, const void *b)
+{
+	const TokenType *lhs = &tokens[*(const uint16_t *)a];
+	const TokenType *rhs = &tokens[*(const uint16_t *)b];
+	int cmp = tokenTickerCmp(lhs->chain_id, lhs->ticker + 1, rhs);
+	if (cmp)
+		return cmp;
+	return (int)*(const uint16_t *)a - (int)*(const uint16_t *)b;
+}
+
+static void tokenBuildIndex(void)
+{
+	if (tokens_indexed)
+		return;
+
+	for (int i = 0; i < TOKENS_COUNT; i++) {
+		tokens_by_address[i] = i;
+		tokens_by_ticker[i] = i;
+	}
+
+	qsort(tokens_by_address, TOKENS_COUNT, sizeof(tokens_by_address[0]),
+	      tokenIndexAddressCmp);
+	qsort(tokens_by_ticker, TOKENS_COUNT, sizeof(tokens_by_ticker[0]),
+	      tokenIndexTickerCmp);
+
+	tokens_indexed = true;
+}
+
 const TokenType *tokenByChainAddress(uint8_t chain_id, const uint8_t *address)
 {
 	if (!address) return 0;
-	for (int i = 0; i < TOKENS_COUNT; i++) {
-		if (chain_id == tokens[i].chain_id && memcmp(address, tokens[i].address, 20) == 0) {
-			return &(tokens[i]);
-		}
+
+	tokenBuildIndex();
+
+	// Lower bound, so that duplicates resolve to the first one in tokens[].
+	size_t lo = 0, hi = TOKENS_COUNT;
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		if (tokenAddressCmp(chain_id, address, &tokens[tokens_by_address[mid]]) > 0)
+			lo = mid + 1;
+		else
+			hi = mid;
 	}
+
+	if (lo < TOKENS_COUNT &&
+	    tokenAddressCmp(chain_id, address, &tokens[tokens_by_address[lo]]) == 0)
+		return &tokens[tokens_by_address[lo]];
+
 	return UnknownToken;
 }
 
@@ -839,13 +915,26 @@ bool tokenByTicker(uint8_t chain_id, const char *ticker, const TokenType **token
 	}
 
 	// Then look in the new table:
-	for (int i = 0; i < TOKENS_COUNT; i++) {
-		if (chain_id == tokens[i].chain_id && strcmp(ticker, tokens[i].ticker + 1) == 0) {
-			if (!*token)
-				*token = &tokens[i];
-			else
-				return false;
-		}
+	tokenBuildIndex();
+
+	size_t lo = 0, hi = TOKENS_COUNT;
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		if (tokenTickerCmp(chain_id, ticker, &tokens[tokens_by_ticker[mid]]) > 0)
+			lo = mid + 1;
+		else
+			hi = mid;
 	}
-	return *token;
+
+	if (lo == TOKENS_COUNT ||
+	    tokenTickerCmp(chain_id, ticker, &tokens[tokens_by_ticker[lo]]) != 0)
+		return false;
+
+	// Tickers aren't unique, so bail if there's more than one match.
+	if (lo + 1 < TOKENS_COUNT &&
+	    tokenTickerCmp(chain_id, ticker, &tokens[tokens_by_ticker[lo + 1]]) == 0)
+		return false;
+
+	*token = &tokens[tokens_by_ticker[lo]];
+	return true;
 }
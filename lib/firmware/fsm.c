@@ -158,8 +158,16 @@ static HDNode *fsm_getDerivedNode(const char *curve, uint32_t *address_n, size_t
 
     if(!storage_getRootNode(curve, true, &node))
     {
-        fsm_sendFailure(FailureType_Failure_NotInitialized,
-                        "Device not initialized or passphrase request cancelled");
+        if(storage_seedJobWasCancelled())
+        {
+            fsm_sendFailure(FailureType_Failure_ActionCancelled,
+                            "Seed derivation cancelled");
+        }
+        else
+        {
+            fsm_sendFailure(FailureType_Failure_NotInitialized,
+                            "Device not initialized or passphrase request cancelled");
+        }
         layoutHome();
         return 0;
     }
@@ -169,7 +177,7 @@ static HDNode *fsm_getDerivedNode(const char *curve, uint32_t *address_n, size_t
         return &node;
     }
 
-    if(hdnode_private_ckd_cached(&node, address_n, address_n_count, fingerprint) == 0)
+    if(cryptoDeriveNodeCached(&node, address_n, address_n_count, fingerprint) == 0)
     {
         fsm_sendFailure(FailureType_Failure_Other, "Failed to derive private key");
         layoutHome();
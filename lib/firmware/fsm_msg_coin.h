@@ -103,6 +103,11 @@ void fsm_msgTxAck(TxAck *msg)
 	signing_txack(&(msg->tx));
 }
 
+void fsm_msgRawTxAck(RawMessage *msg, uint32_t frame_length)
+{
+	signing_raw_txack(msg, frame_length);
+}
+
 // NOTE: there is a very similar copy of this function in coins.c
 //       PLEASE keep both copies in sync.
 static bool path_mismatched(const CoinType *coin, const GetAddress *msg)
@@ -245,6 +250,88 @@ void fsm_msgGetAddress(GetAddress *msg)
 	layoutHome();
 }
 
+static uint32_t fsm_xpubMagic(const CoinType *coin, InputScriptType script_type)
+{
+	if (script_type == InputScriptType_SPENDADDRESS)
+		return coin->xpub_magic;
+	if (coin->has_segwit && script_type == InputScriptType_SPENDP2SHWITNESS)
+		return coin->xpub_magic_segwit_p2sh;
+	if (coin->has_segwit && script_type == InputScriptType_SPENDWITNESS)
+		return coin->xpub_magic_segwit_native;
+	return 0;
+}
+
+void fsm_msgGetAddresses(GetAddresses *msg)
+{
+	RESP_INIT(Addresses);
+
+	CHECK_INITIALIZED
+
+	CHECK_PARAM(msg->count > 0, _("No addresses requested"));
+	CHECK_PARAM(msg->count <= sizeof(resp->address) / sizeof(resp->address[0]),
+	            _("Too many addresses requested"));
+	CHECK_PARAM(msg->address_n_count < sizeof(msg->address_n) / sizeof(msg->address_n[0]),
+	            _("Base path too long"));
+	// Stay on the side of the hardened boundary that start_index is on, so a
+	// non-hardened walk never quietly turns into a hardened one.
+	uint64_t end_index = (uint64_t)msg->start_index + msg->count;
+	CHECK_PARAM(end_index <= ((msg->start_index & 0x80000000) ? 0x100000000ULL : 0x80000000ULL),
+	            _("Index range crosses the hardened boundary"));
+
+	CHECK_PIN
+
+	InputScriptType script_type = msg->has_script_type ? msg->script_type : InputScriptType_SPENDADDRESS;
+
+	const CoinType *coin = fsm_getCoin(msg->has_coin_name, msg->coin_name);
+	if (!coin) return;
+
+	uint32_t xpub_magic = 0;
+	if (msg->has_xpub && msg->xpub) {
+		xpub_magic = fsm_xpubMagic(coin, script_type);
+		CHECK_PARAM(xpub_magic, _("Invalid combination of coin and script_type"));
+	}
+
+	// Derive the shared parent once, and walk its children from there.
+	HDNode *parent = fsm_getDerivedNode(coin->curve_name, msg->address_n, msg->address_n_count, NULL);
+	if (!parent) return;
+	uint32_t fingerprint = hdnode_fingerprint(parent);
+
+	static CONFIDENTIAL HDNode child;
+	for (uint32_t i = 0; i < msg->count; i++) {
+		memcpy(&child, parent, sizeof(child));
+		if (hdnode_private_ckd(&child, msg->start_index + i) == 0) {
+			memzero(&child, sizeof(child));
+			memzero(parent, sizeof(*parent));
+			fsm_sendFailure(FailureType_Failure_Other, "Failed to derive private key");
+			layoutHome();
+			return;
+		}
+		hdnode_fill_public_key(&child);
+
+		if (!compute_address(coin, script_type, &child, false, NULL, resp->address[i])) {
+			memzero(&child, sizeof(child));
+			memzero(parent, sizeof(*parent));
+			fsm_sendFailure(FailureType_Failure_Other, _("Can't encode address"));
+			layoutHome();
+			return;
+		}
+
+		if (xpub_magic) {
+			hdnode_serialize_public(&child, fingerprint, xpub_magic,
+			                        resp->xpub[i], sizeof(resp->xpub[i]));
+		}
+	}
+
+	resp->address_count = msg->count;
+	resp->xpub_count = xpub_magic ? msg->count : 0;
+
+	memzero(&child, sizeof(child));
+	memzero(parent, sizeof(*parent));
+
+	msg_write(MessageType_MessageType_Addresses, resp);
+	layoutHome();
+}
+
 void fsm_msgSignMessage(SignMessage *msg)
 {
 	RESP_INIT(MessageSignature);
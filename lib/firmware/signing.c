@@ -79,12 +79,58 @@ static uint32_t expiry = 0;
 static bool overwintered = false;
 static uint32_t version_group_id = 0;
 static uint32_t next_nonsegwit_input;
+static bool serialize_phase1;
+static uint32_t serialized_inputs;
 static uint32_t progress, progress_step, progress_meta_step;
 static bool multisig_fp_set, multisig_fp_mismatch;
 static uint8_t multisig_fp[32];
 static uint32_t in_address_n[8];
 static size_t in_address_n_count;
 static uint32_t tx_weight;
+static uint32_t batch_size, batch_pending;
+static uint32_t flush_interval;
+
+/* Serialized tx bytes held back until the next flush, see send_req(). */
+static struct {
+	uint8_t bytes[sizeof(resp.serialized.serialized_tx.bytes)];
+	uint32_t size;
+	uint32_t requests;  // TxRequests sent since the last flush
+} ser_held;
+
+/* Fields of a serialized previous transaction, in wire order, as walked by
+ * signing_raw_txack(). */
+typedef enum {
+	RAW_PREV_VERSION,
+	RAW_PREV_INPUTS_COUNT,
+	RAW_PREV_INPUT_PREVOUT,
+	RAW_PREV_INPUT_SCRIPT_LEN,
+	RAW_PREV_INPUT_SCRIPT,
+	RAW_PREV_INPUT_SEQUENCE,
+	RAW_PREV_OUTPUTS_COUNT,
+	RAW_PREV_OUTPUT_AMOUNT,
+	RAW_PREV_OUTPUT_SCRIPT_LEN,
+	RAW_PREV_OUTPUT_SCRIPT,
+	RAW_PREV_LOCK_TIME,
+	RAW_PREV_DONE
+} RawPrevField;
+
+static struct {
+	bool active;
+	uint32_t frame_length;
+	uint32_t frame_remaining;
+	RawPrevField field;
+	uint64_t need;   // bytes still missing from the current field
+	uint8_t buf[9];  // varint or amount being collected
+	uint8_t have;
+	uint64_t count;  // inputs or outputs in the current section
+	uint64_t item;
+} raw_prev;
+
+static void raw_prev_reset(void)
+{
+	raw_prev.active = false;
+	raw_prev.frame_remaining = 0;
+}
 
 /* A marker for in_address_n_count to indicate a mismatch in bip32 paths in
    input */
@@ -97,6 +143,17 @@ static uint32_t tx_weight;
    use and still allow to quickly brute-force the correct bip32 path. */
 #define BIP32_MAX_LAST_ELEMENT 1000000
 
+#define MIN(a,b) (((a)<(b))?(a):(b))
+
+/* The most TxAcks a host may send for a single TxRequest */
+#define BATCH_MAX 64
+
+/* Upper bounds on what answering one TxRequest adds to the serialized tx: an
+ * input or witness, or an output, with the tx header or footer around it */
+#define SER_FRAMING_MAX 32
+#define SER_INPUT_MAX  (32 + 4 + 9 + sizeof(input.script_sig.bytes) + 4 + SER_FRAMING_MAX)
+#define SER_OUTPUT_MAX (8 + 2 + 9 + sizeof(bin_output.script_pubkey.bytes) + SER_FRAMING_MAX)
+
 /* transaction header size: 4 byte version */
 #define TXSIZE_HEADER 4
 /* transaction footer size: 4 byte lock time */
@@ -243,8 +300,14 @@ foreach I (idx1):
     Add I to TransactionChecksum (prevout and type)
     if (Decred)
         Return I
+    if (I and every input before it are segwit)
+        Return I
     If not segwit, Calculate amount of I:
         Request prevhash I, META                                      STAGE_REQUEST_2_PREV_META
+        if (host answers with RawTxAck)
+            Hash the serialized prevtx as it streams in,
+            picking out the amount of prevhash O[prev_index]
+            Skip to the prevhash comparison
         foreach prevhash I (idx2):
             Request prevhash I                                        STAGE_REQUEST_2_PREV_INPUT
         foreach prevhash O (idx2):
@@ -256,7 +319,7 @@ foreach O (idx1):
     Request O                                                         STAGE_REQUEST_3_OUTPUT
     Add O to Decred hash_prefix
     Add O to TransactionChecksum
-    if (Decred)
+    if (Decred or every input was returned above)
         Return O
     Display output
     Ask for confirmation
@@ -269,8 +332,10 @@ Phase2: sign inputs, check that nothing changed
 
 if (Decred)
     Skip to STAGE_REQUEST_DECRED_WITNESS
+if (every input and output was returned in Phase1)
+    Skip to STAGE_REQUEST_SEGWIT_WITNESS
 
-foreach I (idx1):  // input to sign
+foreach I (idx1):  // input to sign, from the first not returned in Phase1
     if (idx1 is segwit)
         Request I                                                     STAGE_REQUEST_SEGWIT_INPUT
         Return serialized input chunk
@@ -319,8 +384,86 @@ foreach I (idx1): // input to sign                                    STAGE_REQU
 
     Sign (hash_type || hash_prefix || hash_witness)
     Return witness
+
+Batching
+========
+
+If SignTx sets batch_size, requests for prevhash I, prevhash O and the
+STAGE_REQUEST_4_INPUT/4_OUTPUT streams carry a request_count: the host sends
+that many consecutive TxAcks, starting at request_index, without waiting for
+a TxRequest in between.  Each is handled as above; the requests they answer
+are simply not sent.  None of these stages returns serialized data before the
+last element of a batch.
+
+Buffered serialization
+======================
+
+Every chunk of the signed tx is appended to resp.serialized by
+serialize_input()/serialize_output() (and the witness serializers), so that
+normally it goes out with the very next TxRequest.  If SignTx sets
+flush_interval, chunks are held back instead and returned as one contiguous
+piece with every flush_interval-th TxRequest, with any TxRequest carrying a
+signature, before the held bytes could no longer take the next element, and
+with TXFINISHED.  The host concatenates serialized_tx in the order received
+either way.
 */
 
+/*
+ * Write the TxRequest in resp.  With flush_interval set, the serialized_tx
+ * chunk of this step is queued behind the held bytes, and all of them are only
+ * attached when a flush is due.
+ */
+static void send_req(void)
+{
+	if (flush_interval > 1) {
+		TxRequestSerializedType *ser = &resp.serialized;
+		// ser_held never grows past what leaves room for one more element
+		memcpy(ser_held.bytes + ser_held.size, ser->serialized_tx.bytes, ser->serialized_tx.size);
+		ser_held.size += ser->serialized_tx.size;
+		ser_held.requests++;
+
+		// the most answering this request can add to the serialized tx
+		uint32_t reserve = SER_INPUT_MAX;
+		if (signing_stage == STAGE_REQUEST_3_OUTPUT || signing_stage == STAGE_REQUEST_5_OUTPUT) {
+			reserve = SER_OUTPUT_MAX;
+		}
+		if (resp.request_type == RequestType_TXFINISHED
+			|| ser->has_signature
+			|| ser_held.requests >= flush_interval
+			|| ser_held.size + reserve > sizeof(ser_held.bytes)) {
+			memcpy(ser->serialized_tx.bytes, ser_held.bytes, ser_held.size);
+			ser->serialized_tx.size = ser_held.size;
+			ser_held.size = 0;
+			ser_held.requests = 0;
+		} else {
+			ser->serialized_tx.size = 0;
+		}
+		ser->has_serialized_tx = ser->serialized_tx.size > 0;
+		resp.has_serialized = ser->has_serialized_tx || ser->has_signature;
+	}
+	msg_write(MessageType_MessageType_TxRequest, &resp);
+}
+
+/*
+ * Send the TxRequest in resp, unless the host already answered it as part of
+ * the previous batch. remaining is how many consecutive elements of the same
+ * stream, this one included, are left to request.
+ */
+static void send_req_batch(uint32_t remaining)
+{
+	if (batch_pending > 0) {
+		batch_pending--;
+		return;
+	}
+	uint32_t count = MIN(batch_size, remaining);
+	if (count > 1) {
+		resp.details.has_request_count = true;
+		resp.details.request_count = count;
+	}
+	batch_pending = count - 1;
+	send_req();
+}
+
 void send_req_1_input(void)
 {
 	signing_stage = STAGE_REQUEST_1_INPUT;
@@ -329,7 +472,7 @@ void send_req_1_input(void)
 	resp.has_details = true;
 	resp.details.has_request_index = true;
 	resp.details.request_index = idx1;
-	msg_write(MessageType_MessageType_TxRequest, &resp);
+	send_req();
 }
 
 void send_req_2_prev_meta(void)
@@ -341,7 +484,7 @@ void send_req_2_prev_meta(void)
 	resp.details.has_tx_hash = true;
 	resp.details.tx_hash.size = input.prev_hash.size;
 	memcpy(resp.details.tx_hash.bytes, input.prev_hash.bytes, input.prev_hash.size);
-	msg_write(MessageType_MessageType_TxRequest, &resp);
+	send_req();
 }
 
 void send_req_2_prev_input(void)
@@ -355,7 +498,7 @@ void send_req_2_prev_input(void)
 	resp.details.has_tx_hash = true;
 	resp.details.tx_hash.size = input.prev_hash.size;
 	memcpy(resp.details.tx_hash.bytes, input.prev_hash.bytes, resp.details.tx_hash.size);
-	msg_write(MessageType_MessageType_TxRequest, &resp);
+	send_req_batch(tp.inputs_len - idx2);
 }
 
 void send_req_2_prev_output(void)
@@ -369,7 +512,7 @@ void send_req_2_prev_output(void)
 	resp.details.has_tx_hash = true;
 	resp.details.tx_hash.size = input.prev_hash.size;
 	memcpy(resp.details.tx_hash.bytes, input.prev_hash.bytes, resp.details.tx_hash.size);
-	msg_write(MessageType_MessageType_TxRequest, &resp);
+	send_req_batch(tp.outputs_len - idx2);
 }
 
 void send_req_2_prev_extradata(uint32_t chunk_offset, uint32_t chunk_len)
@@ -385,7 +528,7 @@ void send_req_2_prev_extradata(uint32_t chunk_offset, uint32_t chunk_len)
 	resp.details.has_tx_hash = true;
 	resp.details.tx_hash.size = input.prev_hash.size;
 	memcpy(resp.details.tx_hash.bytes, input.prev_hash.bytes, resp.details.tx_hash.size);
-	msg_write(MessageType_MessageType_TxRequest, &resp);
+	send_req();
 }
 
 void send_req_3_output(void)
@@ -396,7 +539,7 @@ void send_req_3_output(void)
 	resp.has_details = true;
 	resp.details.has_request_index = true;
 	resp.details.request_index = idx1;
-	msg_write(MessageType_MessageType_TxRequest, &resp);
+	send_req();
 }
 
 void send_req_4_input(void)
@@ -407,7 +550,7 @@ void send_req_4_input(void)
 	resp.has_details = true;
 	resp.details.has_request_index = true;
 	resp.details.request_index = idx2;
-	msg_write(MessageType_MessageType_TxRequest, &resp);
+	send_req_batch(inputs_count - idx2);
 }
 
 void send_req_4_output(void)
@@ -418,7 +561,7 @@ void send_req_4_output(void)
 	resp.has_details = true;
 	resp.details.has_request_index = true;
 	resp.details.request_index = idx2;
-	msg_write(MessageType_MessageType_TxRequest, &resp);
+	send_req_batch(outputs_count - idx2);
 }
 
 void send_req_segwit_input(void)
@@ -429,7 +572,7 @@ void send_req_segwit_input(void)
 	resp.has_details = true;
 	resp.details.has_request_index = true;
 	resp.details.request_index = idx1;
-	msg_write(MessageType_MessageType_TxRequest, &resp);
+	send_req();
 }
 
 void send_req_segwit_witness(void)
@@ -440,7 +583,7 @@ void send_req_segwit_witness(void)
 	resp.has_details = true;
 	resp.details.has_request_index = true;
 	resp.details.request_index = idx1;
-	msg_write(MessageType_MessageType_TxRequest, &resp);
+	send_req();
 }
 
 void send_req_decred_witness(void)
@@ -451,7 +594,7 @@ void send_req_decred_witness(void)
 	resp.has_details = true;
 	resp.details.has_request_index = true;
 	resp.details.request_index = idx1;
-	msg_write(MessageType_MessageType_TxRequest, &resp);
+	send_req();
 }
 
 void send_req_5_output(void)
@@ -462,14 +605,14 @@ void send_req_5_output(void)
 	resp.has_details = true;
 	resp.details.has_request_index = true;
 	resp.details.request_index = idx1;
-	msg_write(MessageType_MessageType_TxRequest, &resp);
+	send_req();
 }
 
 void send_req_finished(void)
 {
 	resp.has_request_type = true;
 	resp.request_type = RequestType_TXFINISHED;
-	msg_write(MessageType_MessageType_TxRequest, &resp);
+	send_req();
 }
 
 void phase1_request_next_input(void)
@@ -625,6 +768,18 @@ void signing_init(const SignTx *msg, const CoinType *_coin, const HDNode *_root)
 	multisig_fp_set = false;
 	multisig_fp_mismatch = false;
 	next_nonsegwit_input = 0xffffffff;
+	batch_size = 1;
+	if (msg->has_batch_size && msg->batch_size > 1) {
+		batch_size = MIN(msg->batch_size, BATCH_MAX);
+	}
+	batch_pending = 0;
+	flush_interval = msg->has_flush_interval ? msg->flush_interval : 0;
+	ser_held.size = 0;
+	ser_held.requests = 0;
+	raw_prev_reset();
+	// Decred serializes its prefix in Phase 1 by itself
+	serialize_phase1 = !_coin->decred;
+	serialized_inputs = 0;
 
 	curve = get_curve_by_name(coin->curve_name);
 	if (!curve)
@@ -660,7 +815,22 @@ void signing_init(const SignTx *msg, const CoinType *_coin, const HDNode *_root)
 	set_exchange_error(NO_EXCHANGE_ERROR);
 }
 
-#define MIN(a,b) (((a)<(b))?(a):(b))
+/* Append to the serialized tx returned with the next TxRequest. */
+static void serialize_input(const TxInputType *txinput)
+{
+	TxRequestSerializedType *ser = &resp.serialized;
+	resp.has_serialized = true;
+	ser->has_serialized_tx = true;
+	ser->serialized_tx.size += tx_serialize_input(&to, txinput, ser->serialized_tx.bytes + ser->serialized_tx.size);
+}
+
+static void serialize_output(const TxOutputBinType *txoutput)
+{
+	TxRequestSerializedType *ser = &resp.serialized;
+	resp.has_serialized = true;
+	ser->has_serialized_tx = true;
+	ser->serialized_tx.size += tx_serialize_output(&to, txoutput, ser->serialized_tx.bytes + ser->serialized_tx.size);
+}
 
 static bool signing_check_input(TxInputType *txinput) {
 	/* compute multisig fingerprint */
@@ -697,9 +867,7 @@ static bool signing_check_input(TxInputType *txinput) {
 		}
 
 		// serialize Decred prefix in Phase 1
-		resp.has_serialized = true;
-		resp.serialized.has_serialized_tx = true;
-		resp.serialized.serialized_tx.size = tx_serialize_input(&to, txinput, resp.serialized.serialized_tx.bytes);
+		serialize_input(txinput);
 
 		// compute Decred hashPrefix
 		tx_serialize_input_hash(&ti, txinput);
@@ -796,12 +964,14 @@ static bool signing_check_output(TxOutputType *txoutput) {
 	}
 	if (coin->decred) {
 		// serialize Decred prefix in Phase 1
-		resp.has_serialized = true;
-		resp.serialized.has_serialized_tx = true;
-		resp.serialized.serialized_tx.size = tx_serialize_output(&to, &bin_output, resp.serialized.serialized_tx.bytes);
+		serialize_output(&bin_output);
 
 		// compute Decred hashPrefix
 		tx_serialize_output_hash(&ti, &bin_output);
+	} else if (serialize_phase1) {
+		// every input is already serialized, so the outputs can follow now
+		// rather than being streamed again in Phase 2
+		serialize_output(&bin_output);
 	}
 	//  compute segwit hashOuts
 	tx_output_hash(&hasher_outputs, &bin_output, coin->decred);
@@ -867,7 +1037,12 @@ static void phase1_request_next_output(void) {
 		if (coin->decred) {
 			// Decred prefix serialized in Phase 1, skip Phase 2
 			send_req_decred_witness();
+		} else if (serialize_phase1) {
+			// all-segwit: inputs and outputs serialized in Phase 1, skip Phase 2
+			send_req_segwit_witness();
 		} else {
+			// resume after the inputs already serialized in Phase 1
+			idx1 = serialized_inputs;
 			phase2_request_next_input();
 		}
 	}
@@ -1003,7 +1178,42 @@ static bool signing_sign_input(void) {
 	resp.has_serialized = true;
 	if (!signing_sign_hash(&input, privkey, pubkey, hash))
 		return false;
-	resp.serialized.serialized_tx.size = tx_serialize_input(&to, &input, resp.serialized.serialized_tx.bytes);
+	serialize_input(&input);
+	return true;
+}
+
+static bool signing_witness_script_sig(TxInputType *txinput) {
+	// Fill in the scriptSig a segwit input carries in the serialized tx
+	if (txinput->script_type == InputScriptType_SPENDP2SHWITNESS
+		&& !txinput->has_multisig) {
+		if (!compile_input_script_sig(txinput)) {
+			fsm_sendFailure(FailureType_Failure_Other, _("Failed to compile input"));
+			signing_abort();
+			return false;
+		}
+		// fixup normal p2pkh script into witness 0 p2wpkh script for p2sh
+		// we convert 76 A9 14 <digest> 88 AC  to 16 00 14 <digest>
+		// P2SH input pushes witness 0 script
+		txinput->script_sig.size = 0x17; // drops last 2 bytes.
+		txinput->script_sig.bytes[0] = 0x16; // push 22 bytes; replaces OP_DUP
+		txinput->script_sig.bytes[1] = 0x00; // witness 0 script ; replaces OP_HASH160
+		// digest is already in right place.
+	} else if (txinput->script_type == InputScriptType_SPENDP2SHWITNESS) {
+		// Prepare P2SH witness script.
+		txinput->script_sig.size = 0x23; // 35 bytes long:
+		txinput->script_sig.bytes[0] = 0x22; // push 34 bytes (full witness script)
+		txinput->script_sig.bytes[1] = 0x00; // witness 0 script
+		txinput->script_sig.bytes[2] = 0x20; // push 32 bytes (digest)
+		// compute digest of multisig script
+		if (!compile_script_multisig_hash(coin, &txinput->multisig, txinput->script_sig.bytes + 3)) {
+			fsm_sendFailure(FailureType_Failure_Other, _("Failed to compile input"));
+			signing_abort();
+			return false;
+		}
+	} else {
+		// direct witness scripts require zero scriptSig
+		txinput->script_sig.size = 0;
+	}
 	return true;
 }
 
@@ -1091,6 +1301,11 @@ static bool signing_sign_decred_input(TxInputType *txinput) {
 void signing_txack(TransactionType *tx)
 {
 	if (!signing) {
+		if (batch_pending > 0) {
+			// rest of a batch sent before signing was aborted
+			batch_pending--;
+			return;
+		}
 		fsm_sendFailure(FailureType_Failure_UnexpectedMessage, _("Not in Signing mode"));
 		layoutHome();
 		return;
@@ -1138,12 +1353,15 @@ void signing_txack(TransactionType *tx)
 					}
 					to_spend += tx->inputs[0].amount;
 					authorized_amount += tx->inputs[0].amount;
+					// its scriptSig needs a signature, so it waits for Phase 2
+					serialize_phase1 = false;
 					phase1_request_next_input();
 				} else {
 					// remember the first non-segwit input -- this is the first input
 					// we need to sign during phase2
 					if (next_nonsegwit_input == 0xffffffff)
 						next_nonsegwit_input = idx1;
+					serialize_phase1 = false;
 					send_req_2_prev_meta();
 				}
 			} else if  (tx->inputs[0].script_type == InputScriptType_SPENDWITNESS
@@ -1185,6 +1403,16 @@ void signing_txack(TransactionType *tx)
 #endif
 				to_spend += tx->inputs[0].amount;
 				authorized_amount += tx->inputs[0].amount;
+				if (serialize_phase1) {
+					// Nothing in a segwit input's serialization depends on the
+					// signature, so while every input so far is segwit return it
+					// now, instead of requesting it again in Phase 2.
+					if (!signing_witness_script_sig(&tx->inputs[0])) {
+						return;
+					}
+					serialize_input(&tx->inputs[0]);
+					serialized_inputs++;
+				}
 				phase1_request_next_input();
 			} else {
 				fsm_sendFailure(FailureType_Failure_SyntaxError, _("Wrong input script type"));
@@ -1415,37 +1643,10 @@ void signing_txack(TransactionType *tx)
 				progress = 500 + ((signatures * progress_step) >> PROGRESS_PRECISION);
 				animating_progress_handler(); // layoutProgress(_("Signing transaction"), progress);
 				update_ctr = 0;
-			} else if (tx->inputs[0].script_type == InputScriptType_SPENDP2SHWITNESS
-					   && !tx->inputs[0].has_multisig) {
-				if (!compile_input_script_sig(&tx->inputs[0])) {
-					fsm_sendFailure(FailureType_Failure_Other, _("Failed to compile input"));
-					signing_abort();
-					return;
-				}
-				// fixup normal p2pkh script into witness 0 p2wpkh script for p2sh
-				// we convert 76 A9 14 <digest> 88 AC  to 16 00 14 <digest>
-				// P2SH input pushes witness 0 script
-				tx->inputs[0].script_sig.size = 0x17; // drops last 2 bytes.
-				tx->inputs[0].script_sig.bytes[0] = 0x16; // push 22 bytes; replaces OP_DUP
-				tx->inputs[0].script_sig.bytes[1] = 0x00; // witness 0 script ; replaces OP_HASH160
-				// digest is already in right place.
-			} else if (tx->inputs[0].script_type == InputScriptType_SPENDP2SHWITNESS) {
-				// Prepare P2SH witness script.
-				tx->inputs[0].script_sig.size = 0x23; // 35 bytes long:
-				tx->inputs[0].script_sig.bytes[0] = 0x22; // push 34 bytes (full witness script)
-				tx->inputs[0].script_sig.bytes[1] = 0x00; // witness 0 script
-				tx->inputs[0].script_sig.bytes[2] = 0x20; // push 32 bytes (digest)
-				// compute digest of multisig script
-				if (!compile_script_multisig_hash(coin, &tx->inputs[0].multisig, tx->inputs[0].script_sig.bytes + 3)) {
-					fsm_sendFailure(FailureType_Failure_Other, _("Failed to compile input"));
-					signing_abort();
-					return;
-				}
-			} else {
-				// direct witness scripts require zero scriptSig
-				tx->inputs[0].script_sig.size = 0;
+			} else if (!signing_witness_script_sig(&tx->inputs[0])) {
+				return;
 			}
-			resp.serialized.serialized_tx.size = tx_serialize_input(&to, &tx->inputs[0], resp.serialized.serialized_tx.bytes);
+			serialize_input(&tx->inputs[0]);
 			if (idx1 < inputs_count - 1) {
 				idx1++;
 				phase2_request_next_input();
@@ -1462,9 +1663,7 @@ void signing_txack(TransactionType *tx)
 				signing_abort();
 				return;
 			}
-			resp.has_serialized = true;
-			resp.serialized.has_serialized_tx = true;
-			resp.serialized.serialized_tx.size = tx_serialize_output(&to, &bin_output, resp.serialized.serialized_tx.bytes);
+			serialize_output(&bin_output);
 			if (idx1 < outputs_count - 1) {
 				idx1++;
 				send_req_5_output();
@@ -1549,8 +1748,267 @@ void signing_txack(TransactionType *tx)
 	signing_abort();
 }
 
+static void raw_prev_next(RawPrevField field, uint64_t need)
+{
+	raw_prev.field = field;
+	raw_prev.need = need;
+	raw_prev.have = 0;
+}
+
+// skip over the rest of the current field, true once it is complete
+static bool raw_prev_skip(const uint8_t **data, uint32_t *len)
+{
+	uint32_t n = MIN((uint64_t)*len, raw_prev.need);
+	raw_prev.need -= n;
+	*data += n;
+	*len -= n;
+	return raw_prev.need == 0;
+}
+
+// collect the rest of the current field into raw_prev.buf
+static bool raw_prev_collect(const uint8_t **data, uint32_t *len)
+{
+	uint32_t n = MIN((uint64_t)*len, raw_prev.need);
+	memcpy(raw_prev.buf + raw_prev.have, *data, n);
+	raw_prev.have += n;
+	return raw_prev_skip(data, len);
+}
+
+static uint64_t raw_prev_le(const uint8_t *buf, uint8_t len)
+{
+	uint64_t value = 0;
+	while (len--) {
+		value = (value << 8) | buf[len];
+	}
+	return value;
+}
+
+static bool raw_prev_varint(const uint8_t **data, uint32_t *len, uint64_t *value)
+{
+	if (!raw_prev_collect(data, len)) {
+		return false;
+	}
+	if (raw_prev.have == 1 && raw_prev.buf[0] >= 0xfd) {
+		raw_prev.need = raw_prev.buf[0] == 0xfd ? 2 : (raw_prev.buf[0] == 0xfe ? 4 : 8);
+		if (!raw_prev_collect(data, len)) {
+			return false;
+		}
+	}
+	*value = raw_prev.have == 1 ? raw_prev.buf[0] : raw_prev_le(raw_prev.buf + 1, raw_prev.have - 1);
+	return true;
+}
+
+/*
+ * Walk one chunk of a serialized (non-witness) previous transaction. Scripts
+ * and prevouts are only skipped over; the sole value kept is the amount of
+ * output input.prev_index, which is added to to_spend.
+ */
+static bool raw_prev_parse(const uint8_t *data, uint32_t len)
+{
+	uint64_t value;
+
+	// zero length scripts complete without consuming any data
+	while (len > 0 || (raw_prev.need == 0 && raw_prev.field != RAW_PREV_DONE)) {
+		switch (raw_prev.field) {
+			case RAW_PREV_VERSION:
+				if (!raw_prev_skip(&data, &len)) {
+					return true;
+				}
+				raw_prev_next(RAW_PREV_INPUTS_COUNT, 1);
+				break;
+			case RAW_PREV_INPUTS_COUNT:
+				if (!raw_prev_varint(&data, &len, &value)) {
+					return true;
+				}
+				if (value == 0) {
+					// either the segwit marker or a tx that can't be spent from
+					fsm_sendFailure(FailureType_Failure_SyntaxError, _("Previous transaction must not include witness data"));
+					return false;
+				}
+				raw_prev.count = value;
+				raw_prev.item = 0;
+				raw_prev_next(RAW_PREV_INPUT_PREVOUT, 36);
+				break;
+			case RAW_PREV_INPUT_PREVOUT:
+				if (!raw_prev_skip(&data, &len)) {
+					return true;
+				}
+				raw_prev_next(RAW_PREV_INPUT_SCRIPT_LEN, 1);
+				break;
+			case RAW_PREV_INPUT_SCRIPT_LEN:
+				if (!raw_prev_varint(&data, &len, &value)) {
+					return true;
+				}
+				raw_prev_next(RAW_PREV_INPUT_SCRIPT, value);
+				break;
+			case RAW_PREV_INPUT_SCRIPT:
+				if (!raw_prev_skip(&data, &len)) {
+					return true;
+				}
+				raw_prev_next(RAW_PREV_INPUT_SEQUENCE, 4);
+				break;
+			case RAW_PREV_INPUT_SEQUENCE:
+				if (!raw_prev_skip(&data, &len)) {
+					return true;
+				}
+				if (++raw_prev.item < raw_prev.count) {
+					raw_prev_next(RAW_PREV_INPUT_PREVOUT, 36);
+				} else {
+					raw_prev_next(RAW_PREV_OUTPUTS_COUNT, 1);
+				}
+				break;
+			case RAW_PREV_OUTPUTS_COUNT:
+				if (!raw_prev_varint(&data, &len, &value)) {
+					return true;
+				}
+				if (value <= input.prev_index) {
+					fsm_sendFailure(FailureType_Failure_SyntaxError, _("Not enough outputs in previous transaction."));
+					return false;
+				}
+				raw_prev.count = value;
+				raw_prev.item = 0;
+				raw_prev_next(RAW_PREV_OUTPUT_AMOUNT, 8);
+				break;
+			case RAW_PREV_OUTPUT_AMOUNT:
+				if (!raw_prev_collect(&data, &len)) {
+					return true;
+				}
+				if (raw_prev.item == input.prev_index) {
+					value = raw_prev_le(raw_prev.buf, 8);
+					if (to_spend + value < to_spend) {
+						fsm_sendFailure(FailureType_Failure_SyntaxError, _("Value overflow"));
+						return false;
+					}
+					to_spend += value;
+				}
+				raw_prev_next(RAW_PREV_OUTPUT_SCRIPT_LEN, 1);
+				break;
+			case RAW_PREV_OUTPUT_SCRIPT_LEN:
+				if (!raw_prev_varint(&data, &len, &value)) {
+					return true;
+				}
+				raw_prev_next(RAW_PREV_OUTPUT_SCRIPT, value);
+				break;
+			case RAW_PREV_OUTPUT_SCRIPT:
+				if (!raw_prev_skip(&data, &len)) {
+					return true;
+				}
+				if (++raw_prev.item < raw_prev.count) {
+					raw_prev_next(RAW_PREV_OUTPUT_AMOUNT, 8);
+				} else {
+					raw_prev_next(RAW_PREV_LOCK_TIME, 4);
+				}
+				break;
+			case RAW_PREV_LOCK_TIME:
+				if (!raw_prev_skip(&data, &len)) {
+					return true;
+				}
+				raw_prev_next(RAW_PREV_DONE, 0);
+				break;
+			case RAW_PREV_DONE:
+				fsm_sendFailure(FailureType_Failure_SyntaxError, _("Unexpected data after previous transaction"));
+				return false;
+		}
+	}
+	return true;
+}
+
+// Abort signing from within a frame, and swallow the rest of that frame.
+static void raw_prev_abort(void)
+{
+	uint32_t remaining = raw_prev.frame_remaining;
+	signing_abort();
+	raw_prev.frame_remaining = remaining;
+}
+
+/*
+ * The host may answer a TXMETA request with RawTxAck instead of TxAck: the
+ * frame payload is then the whole previous transaction in its wire
+ * serialization, without witness data. It is hashed segment by segment as it
+ * arrives, so a prevtx with thousands of outputs costs one USB transfer
+ * rather than one TxRequest/TxAck round trip per input and output.
+ */
+void signing_raw_txack(RawMessage *msg, uint32_t frame_length)
+{
+	static int update_ctr = 0;
+	bool first_segment = raw_prev.frame_remaining == 0;
+
+	if (first_segment) {
+		raw_prev.frame_length = frame_length;
+		raw_prev.frame_remaining = frame_length;
+	}
+
+	// the first and last segments are padded out to a full report
+	uint32_t len = MIN(msg->length, raw_prev.frame_remaining);
+	raw_prev.frame_remaining -= len;
+
+	if (first_segment) {
+		raw_prev.active = false;
+
+		if (!signing) {
+			fsm_sendFailure(FailureType_Failure_UnexpectedMessage, _("Not in Signing mode"));
+			layoutHome();
+			return;
+		}
+
+		if (signing_stage != STAGE_REQUEST_2_PREV_META) {
+			fsm_sendFailure(FailureType_Failure_UnexpectedMessage, _("Unexpected raw transaction"));
+			raw_prev_abort();
+			return;
+		}
+
+		// those serialize prevtx differently, and carry extra data
+		if (coin->decred || overwintered) {
+			fsm_sendFailure(FailureType_Failure_Other, _("Raw previous transaction not supported for this coin"));
+			raw_prev_abort();
+			return;
+		}
+
+		tx_init(&tp, 0, 0, 0, 0, 0, 0, curve->hasher_sign, false, 0);
+		raw_prev_next(RAW_PREV_VERSION, 4);
+		raw_prev.active = true;
+	}
+
+	if (!raw_prev.active) {
+		// rest of a frame that was already rejected
+		return;
+	}
+
+	hasher_Update(&tp.hasher, msg->buffer, len);
+	if (!raw_prev_parse(msg->buffer, len)) {
+		raw_prev.active = false;
+		raw_prev_abort();
+		return;
+	}
+
+	if (raw_prev.frame_length > 0) {
+		uint64_t done = raw_prev.frame_length - raw_prev.frame_remaining;
+		progress = (idx1 * progress_step + (uint32_t)(progress_step * done / raw_prev.frame_length)) >> PROGRESS_PRECISION;
+	}
+	if (update_ctr++ == 20) {
+		animating_progress_handler(); //layoutProgress(_("Signing transaction"), progress);
+		update_ctr = 0;
+	}
+
+	if (raw_prev.frame_remaining > 0) {
+		return;
+	}
+
+	raw_prev.active = false;
+	if (raw_prev.field != RAW_PREV_DONE) {
+		fsm_sendFailure(FailureType_Failure_SyntaxError, _("Truncated previous transaction"));
+		raw_prev_abort();
+		return;
+	}
+
+	memset(&resp, 0, sizeof(TxRequest));
+	signing_check_prevtx_hash();
+}
+
 void signing_abort(void)
 {
+	// a RawTxAck frame cut short must not carry over into the next one
+	raw_prev_reset();
 	if (signing) {
 		layoutHome();
 		signing = false;
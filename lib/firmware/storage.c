@@ -31,8 +31,11 @@
 #include "keepkey/board/keepkey_board.h"
 #include "keepkey/board/keepkey_flash.h"
 #include "keepkey/board/memory.h"
+#include "keepkey/board/msg_dispatch.h"
+#include "keepkey/board/timer.h"
 #include "keepkey/board/u2f.h"
 #include "keepkey/board/variant.h"
+#include "keepkey/firmware/crypto.h"
 #include "keepkey/firmware/fsm.h"
 #include "keepkey/firmware/passphrase_sm.h"
 #include "keepkey/firmware/policy.h"
@@ -52,6 +55,14 @@
 
 #define MAX(a, b) ({ typeof(a) _a = (a); typeof(b) _b = (b); _a > _b ? _a : _b; })
 
+/* Number of chunks the BIP39 PBKDF2 is split into, between USB polls */
+#define SEED_JOB_CHUNKS 16
+
+/* Window in which deferred commits are coalesced into one flash write */
+#define STORAGE_COMMIT_DELAY_MS 500
+
+extern bool reset_msg_stack;
+
 static bool sessionSeedCached, sessionSeedUsesPassphrase;
 static uint8_t CONFIDENTIAL sessionSeed[64];
 
@@ -61,6 +72,16 @@ static uint8_t CONFIDENTIAL sessionStorageKey[64];
 static bool sessionPassphraseCached;
 static char CONFIDENTIAL sessionPassphrase[51];
 
+/* Resumable BIP39 seed derivation state */
+static struct {
+    bool active;
+    uint32_t rounds;
+    PBKDF2_HMAC_SHA512_CTX pctx;
+} CONFIDENTIAL seed_job;
+
+/* Whether the host abandoned the last seed derivation */
+static bool seed_job_cancelled;
+
 static Allocation storage_location = FLASH_INVALID;
 
 /* Shadow memory for configuration data in storage partition */
@@ -71,6 +92,17 @@ static ConfigFlash CONFIDENTIAL shadow_config;
 // Temporary storage for marshalling secrets in & out of flash.
 static CONFIDENTIAL char flash_temp[1024];
 
+// Deferred commit, due once timer_ticks() reaches storage_commit_deadline.
+// Only the main loop looks at these, so the timer's runnable queue, which
+// its isr walks, is left alone.
+static bool storage_commit_deferred = false;
+static uint32_t storage_commit_deadline;
+
+_Static_assert(STORAGE_JOURNAL_OFFSET == sizeof(flash_temp),
+               "the journal starts right after the committed image");
+_Static_assert(STORAGE_JOURNAL_OFFSET % sizeof(StorageJournalRecord) == 0,
+               "journal records must be word aligned");
+
 #if DEBUG_LINK
 // These won't survive resets like the stuff in flash would, but thats a
 // reasonable compromise given how testing works.
@@ -79,6 +111,94 @@ char debuglink_mnemonic[241];
 HDNode debuglink_node;
 #endif
 
+static bool storage_isActiveSector(const char *flash);
+
+static const StorageJournalRecord *storage_journal(void)
+{
+    return (const StorageJournalRecord *)
+        (flash_write_helper(storage_location) + STORAGE_JOURNAL_OFFSET);
+}
+
+static bool storage_journalRecordValid(const StorageJournalRecord *rec)
+{
+    return (rec->key >> 16) == (~rec->key & 0xffff);
+}
+
+static bool storage_journalSlotFree(const StorageJournalRecord *rec)
+{
+    return rec->key == STORAGE_JOURNAL_ERASED &&
+           rec->value == STORAGE_JOURNAL_ERASED;
+}
+
+/// \returns the index of the first unused journal slot.
+static size_t storage_journalEnd(void)
+{
+    const StorageJournalRecord *journal = storage_journal();
+    size_t i;
+    for (i = 0; i < STORAGE_JOURNAL_LEN / sizeof(StorageJournalRecord); i++) {
+        if (storage_journalSlotFree(&journal[i]))
+            break;
+    }
+    return i;
+}
+
+/// \brief Apply journalled values over the image loaded from flash.
+static void storage_journalReplay(ConfigFlash *cfg)
+{
+    const StorageJournalRecord *journal = storage_journal();
+    size_t end = storage_journalEnd();
+    for (size_t i = 0; i < end; i++) {
+        // Slots torn by a power loss between the value and key writes are skipped.
+        if (!storage_journalRecordValid(&journal[i]))
+            continue;
+
+        switch (journal[i].key & 0xffff) {
+        case SJK_U2FCounter:
+            cfg->storage.pub.u2f_counter = journal[i].value;
+            break;
+        case SJK_PinFails:
+            cfg->storage.pub.pin_failed_attempts = journal[i].value;
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+/// \brief Persist a single field by appending a record to the journal,
+///        falling back to a full commit when that isn't possible.
+static void storage_journalAppend(StorageJournalKey key, uint32_t value)
+{
+    if (storage_location < FLASH_STORAGE1 || storage_location > FLASH_STORAGE3 ||
+        !storage_isActiveSector((const char *)flash_write_helper(storage_location))) {
+        storage_commit();
+        return;
+    }
+
+    size_t end = storage_journalEnd();
+    if (end >= STORAGE_JOURNAL_LEN / sizeof(StorageJournalRecord)) {
+        // Journal is full, so compact into a fresh sector.
+        storage_commit();
+        return;
+    }
+
+    StorageJournalRecord rec;
+    rec.key = ((~(uint32_t)key & 0xffff) << 16) | key;
+    rec.value = value;
+
+    uint32_t offset = STORAGE_JOURNAL_OFFSET + end * sizeof(rec);
+
+    // Value first, so that a record only becomes valid once it is complete.
+    if (!flash_write_word(storage_location, offset + sizeof(rec.key),
+                          sizeof(rec.value), (uint8_t *)&rec.value) ||
+        !flash_write_word(storage_location, offset,
+                          sizeof(rec.key), (uint8_t *)&rec.key) ||
+        memcmp(&storage_journal()[end], &rec, sizeof(rec)) != 0) {
+        storage_commit();
+        return;
+    }
+}
+
 static void get_u2froot_callback(uint32_t iter, uint32_t total)
 {
 	(void)iter;
@@ -114,11 +234,12 @@ bool storage_getU2FRoot(HDNode *node)
 
 uint32_t storage_nextU2FCounter(void) {
 	shadow_config.storage.pub.u2f_counter++;
-	storage_commit();
+	storage_journalAppend(SJK_U2FCounter, shadow_config.storage.pub.u2f_counter);
 	return shadow_config.storage.pub.u2f_counter;
 }
 
 void storage_setU2FCounter(uint32_t u2f_counter) {
+	// Not deferred: a counter lost on reset would go backwards.
 	shadow_config.storage.pub.u2f_counter = u2f_counter;
 	storage_commit();
 }
@@ -708,7 +829,7 @@ static void storage_setRootSeedCache(ConfigFlash *cfg, const uint8_t *seed, cons
 
     cfg->storage.sec.cache.root_seed_cache_status = CACHE_EXISTS;
     cfg->storage.has_sec = true;
-    storage_commit();
+    storage_commitDeferred();
 }
 
 /// \brief Get root session seed cache from storage.
@@ -799,8 +920,10 @@ void storage_init(void)
         storage_commit();
         break;
     case SUS_Valid:
+        storage_journalReplay(&shadow_config);
         break;
     case SUS_Updated:
+        storage_journalReplay(&shadow_config);
         // If the version changed, write the new storage to flash so
         // that it's available on next boot without conversion.
         storage_commit();
@@ -845,6 +968,7 @@ void storage_reset_impl(ConfigFlash *cfg, uint8_t storage_key[64])
     memset(&sessionSeed, 0, sizeof(sessionSeed));
     memset(&sessionPassphrase, 0, sizeof(sessionPassphrase));
     memzero(sessionStorageKey, sizeof(sessionStorageKey));
+    cryptoClearDerivationCache();
 
     shadow_config.storage.has_sec = false;
     memzero(&shadow_config.storage.sec, sizeof(shadow_config.storage.sec));
@@ -855,6 +979,8 @@ void session_clear(bool clear_pin)
     sessionSeedCached = false;
     memset(&sessionSeed, 0, sizeof(sessionSeed));
 
+    cryptoClearDerivationCache();
+
     sessionPassphraseCached = false;
     memset(&sessionPassphrase, 0, sizeof(sessionPassphrase));
 
@@ -871,9 +997,25 @@ void session_clear(bool clear_pin)
 }
 
 void storage_commit(void) {
+    storage_commit_deferred = false;
     storage_commit_impl(&shadow_config);
 }
 
+void storage_commitDeferred(void)
+{
+    storage_commit_deadline = timer_ticks() + STORAGE_COMMIT_DELAY_MS;
+    storage_commit_deferred = true;
+}
+
+void storage_commitPending(void)
+{
+    if (!storage_commit_deferred ||
+        (int32_t)(timer_ticks() - storage_commit_deadline) < 0)
+        return;
+
+    storage_commit();
+}
+
 void storage_commit_impl(ConfigFlash *cfg)
 {
     memzero(flash_temp, sizeof(flash_temp));
@@ -888,6 +1030,17 @@ void storage_commit_impl(ConfigFlash *cfg)
 
     memcpy(cfg, STORAGE_MAGIC_STR, STORAGE_MAGIC_LEN);
 
+    /* Nothing is dirty if the active sector already holds this exact image,
+     * and has no journal records on top of it, so skip the erase/program
+     * cycle entirely. */
+    if (storage_location >= FLASH_STORAGE1 && storage_location <= FLASH_STORAGE3 &&
+        storage_journalEnd() == 0 &&
+        memcmp((const void *)flash_write_helper(storage_location), flash_temp,
+               sizeof(flash_temp)) == 0) {
+        memzero(flash_temp, sizeof(flash_temp));
+        return;
+    }
+
     uint32_t retries = 0;
     for (retries = 0; retries < STORAGE_RETRIES; retries++) {
         /* Capture CRC for verification at restore */
@@ -933,6 +1086,7 @@ void storage_commit_impl(ConfigFlash *cfg)
     }
 
     memzero(flash_temp, sizeof(flash_temp));
+    flash_sync();
 
     if(retries >= STORAGE_RETRIES) {
         layout_warning_static("Error Detected.  Reboot Device!");
@@ -1170,14 +1324,15 @@ void storage_resetPinFails(void)
 {
     shadow_config.storage.pub.pin_failed_attempts = 0;
 
-    storage_commit_impl(&shadow_config);
+    storage_journalAppend(SJK_PinFails, 0);
 }
 
 void storage_increasePinFails(void)
 {
     shadow_config.storage.pub.pin_failed_attempts++;
 
-    storage_commit_impl(&shadow_config);
+    storage_journalAppend(SJK_PinFails,
+                          shadow_config.storage.pub.pin_failed_attempts);
 }
 
 uint32_t storage_getPinFails(void)
@@ -1195,6 +1350,72 @@ static void get_root_node_callback(uint32_t iter, uint32_t total)
     animating_progress_handler();
 }
 
+/// \brief Begin a BIP39 mnemonic -> seed derivation that can be run in chunks.
+static void storage_seedJobStart(const char *mnemonic, const char *passphrase)
+{
+    static CONFIDENTIAL uint8_t salt[8 + sizeof(sessionPassphrase)];
+    size_t passphraselen = strnlen(passphrase, sizeof(sessionPassphrase) - 1);
+    memcpy(salt, "mnemonic", 8);
+    memcpy(salt + 8, passphrase, passphraselen);
+
+    memzero(&seed_job, sizeof(seed_job));
+    pbkdf2_hmac_sha512_Init(&seed_job.pctx, (const uint8_t *)mnemonic,
+                            strlen(mnemonic), salt, passphraselen + 8, 1);
+    seed_job.active = true;
+
+    memzero(salt, sizeof(salt));
+}
+
+/// \brief Run up to \p rounds more PBKDF2 iterations of the seed job.
+/// \returns true iff the job has completed all of its rounds.
+static bool storage_seedJobStep(uint32_t rounds)
+{
+    if (!seed_job.active)
+        return true;
+
+    if (seed_job.rounds + rounds > BIP39_PBKDF2_ROUNDS)
+        rounds = BIP39_PBKDF2_ROUNDS - seed_job.rounds;
+
+    pbkdf2_hmac_sha512_Update(&seed_job.pctx, rounds);
+    seed_job.rounds += rounds;
+
+    return seed_job.rounds >= BIP39_PBKDF2_ROUNDS;
+}
+
+/// \brief Extract the seed from a completed job, and clear the job state.
+static void storage_seedJobFinish(uint8_t seed[64])
+{
+    pbkdf2_hmac_sha512_Final(&seed_job.pctx, seed);
+    memzero(&seed_job, sizeof(seed_job));
+}
+
+static void storage_seedJobAbort(void)
+{
+    memzero(&seed_job, sizeof(seed_job));
+}
+
+/// \brief Service the host in between chunks of seed derivation.
+/// \returns true iff the host asked for the derivation to be abandoned.
+static bool storage_seedJobCancelled(void)
+{
+    uint8_t msg_tiny_buf[MSG_TINY_BFR_SZ];
+
+    switch (check_for_tiny_msg(msg_tiny_buf)) {
+    case MessageType_MessageType_Initialize:
+        reset_msg_stack = true;
+        return true;
+    case MessageType_MessageType_Cancel:
+        return true;
+#if DEBUG_LINK
+    case MessageType_MessageType_DebugLinkGetState:
+        call_msg_debug_link_get_state_handler((DebugLinkGetState *)msg_tiny_buf);
+        return false;
+#endif
+    default:
+        return false;
+    }
+}
+
 const uint8_t *storage_getSeed(const ConfigFlash *cfg, bool usePassphrase)
 {
     // root node is properly cached
@@ -1214,9 +1435,17 @@ const uint8_t *storage_getSeed(const ConfigFlash *cfg, bool usePassphrase)
         }
 
         layout_loading();
-        mnemonic_to_seed(cfg->storage.sec.mnemonic,
-                         usePassphrase ? sessionPassphrase : "",
-                         sessionSeed, get_root_node_callback); // BIP-0039
+        storage_seedJobStart(cfg->storage.sec.mnemonic,
+                             usePassphrase ? sessionPassphrase : ""); // BIP-0039
+        while (!storage_seedJobStep(BIP39_PBKDF2_ROUNDS / SEED_JOB_CHUNKS)) {
+            get_root_node_callback(seed_job.rounds, BIP39_PBKDF2_ROUNDS);
+            if (storage_seedJobCancelled()) {
+                storage_seedJobAbort();
+                seed_job_cancelled = true;
+                return NULL;
+            }
+        }
+        storage_seedJobFinish(sessionSeed);
         sessionSeedCached = true;
         sessionSeedUsesPassphrase = usePassphrase;
         return sessionSeed;
@@ -1225,7 +1454,14 @@ const uint8_t *storage_getSeed(const ConfigFlash *cfg, bool usePassphrase)
     return NULL;
 }
 
+bool storage_seedJobWasCancelled(void)
+{
+    return seed_job_cancelled;
+}
+
 bool storage_getRootNode(const char *curve, bool usePassphrase, HDNode *node) {
+    seed_job_cancelled = false;
+
     // if storage has node, decrypt and use it
     if (shadow_config.storage.pub.has_node && strcmp(curve, SECP256K1_NAME) == 0) {
         if (!shadow_config.storage.has_sec) {
@@ -134,6 +134,23 @@ void storage_writeHDNode(char *ptr, size_t len, const HDNodeType *node);
 void storage_writeStorageV11(char *ptr, size_t len, const Storage *storage);
 void storage_writeCacheV1(char *ptr, size_t len, const Cache *cache);
 
+/* Append-only journal of frequently changing fields, kept in the active
+ * storage sector just past the ConfigFlash image. Records are replayed over
+ * the image at boot, and dropped when the next full commit erases the sector. */
+#define STORAGE_JOURNAL_OFFSET 1024
+#define STORAGE_JOURNAL_LEN    (STORAGE_SECTOR_LEN - STORAGE_JOURNAL_OFFSET)
+#define STORAGE_JOURNAL_ERASED 0xFFFFFFFF
+
+typedef enum {
+    SJK_U2FCounter = 1,
+    SJK_PinFails   = 2,
+} StorageJournalKey;
+
+typedef struct {
+    uint32_t key;   // key in the low half, its complement in the high half
+    uint32_t value;
+} StorageJournalRecord;
+
 bool storage_setPolicy_impl(PolicyType policies[POLICY_COUNT], const char *policy_name, bool enabled);
 bool storage_isPolicyEnabled_impl(const PolicyType policies[POLICY_COUNT], const char *policy_name);
 
@@ -0,0 +1,184 @@
+#!/usr/bin/env python3
+"""Launch several kkemu instances side by side, each with its own UDP ports
+and flash image, then drive them concurrently and report aggregate transaction
+signing throughput.  Timing starts once every instance has been loaded.
+
+Requires python-keepkey (keepkeylib) for the wire protocol:
+
+  scripts/emulator/multi-emulator.py --kkemu build/bin/kkemu -n 8 -t 30
+"""
+
+import argparse
+import hashlib
+import os
+import shutil
+import socket
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+from keepkeylib import types_pb2 as proto_types
+from keepkeylib.client import KeepKeyDebugClient
+from keepkeylib.transport_udp import UDPTransport
+
+MNEMONIC = ('alcohol woman abuse must during monitor noble actual mixed '
+            'trade anger aisle')
+
+# Native segwit inputs carry their amount, so signing needs no previous
+# transactions and runs without a tx API.
+INPUT_AMOUNT = 100000
+PAYMENT = proto_types.TxOutputType(
+    address='bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4',
+    amount=90000,
+    script_type=proto_types.PAYTOWITNESS)
+
+
+def wait_ready(port, timeout):
+    """Ping the emulator's main interface until it answers."""
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.settimeout(0.1)
+    deadline = time.time() + timeout
+    try:
+        while time.time() < deadline:
+            sock.sendto(b'PINGPING', ('127.0.0.1', port))
+            try:
+                if sock.recv(64) == b'PONGPONG':
+                    return
+            except socket.timeout:
+                pass
+        raise RuntimeError('emulator on port %d did not come up' % port)
+    finally:
+        sock.close()
+
+
+def connect(port):
+    client = KeepKeyDebugClient(UDPTransport('127.0.0.1:%d' % port))
+    client.set_debuglink(UDPTransport('127.0.0.1:%d' % (port + 1)))
+    return client
+
+
+def spend(count):
+    """A native segwit input spending a made-up output of our own."""
+    return proto_types.TxInputType(
+        address_n=[0x80000054, 0x80000000, 0x80000000, 0, count % 20],
+        prev_hash=hashlib.sha256(b'throughput %d' % count).digest(),
+        prev_index=0,
+        amount=INPUT_AMOUNT,
+        script_type=proto_types.SPENDWITNESS)
+
+
+def worker(port, duration, barrier, results, index):
+    client = connect(port)
+    try:
+        try:
+            client.wipe_device()
+            client.load_device_by_mnemonic(mnemonic=MNEMONIC, pin='',
+                                           passphrase_protection=False,
+                                           label='emulator %d' % index,
+                                           language='english')
+        except Exception:
+            barrier.abort()
+            raise
+
+        # Don't start the clock until every instance is loaded
+        try:
+            barrier.wait()
+        except threading.BrokenBarrierError:
+            return
+
+        count = 0
+        deadline = time.time() + duration
+        while time.time() < deadline:
+            client.sign_tx('Bitcoin', [spend(count)], [PAYMENT])
+            count += 1
+
+        results[index] = count
+    finally:
+        client.close()
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--kkemu', default='build/bin/kkemu',
+                        help='path to the emulator binary')
+    parser.add_argument('-n', '--instances', type=int, default=4)
+    parser.add_argument('-t', '--duration', type=float, default=10.0,
+                        help='seconds to sign transactions for on each '
+                             'instance')
+    parser.add_argument('--port-base', type=int, default=31000,
+                        help='first main port; instance i uses '
+                             'port-base + 2i and the one above it')
+    parser.add_argument('--keep', action='store_true',
+                        help='keep the flash images and logs')
+    args = parser.parse_args()
+
+    workdir = tempfile.mkdtemp(prefix='kkemu-')
+    procs = []
+    logs = []
+    ports = [args.port_base + 2 * i for i in range(args.instances)]
+
+    try:
+        for i, port in enumerate(ports):
+            log = open(os.path.join(workdir, 'kkemu-%d.log' % i), 'w')
+            logs.append(log)
+            procs.append(subprocess.Popen(
+                [os.path.abspath(args.kkemu),
+                 '--port', str(port),
+                 '--flash', os.path.join(workdir, 'emulator-%d.img' % i)],
+                cwd=workdir, stdout=log, stderr=subprocess.STDOUT))
+
+        for port in ports:
+            wait_ready(port, 10)
+
+        results = [0] * args.instances
+        barrier = threading.Barrier(args.instances + 1)
+        threads = [threading.Thread(target=worker,
+                                    args=(port, args.duration, barrier,
+                                          results, i))
+                   for i, port in enumerate(ports)]
+
+        for t in threads:
+            t.start()
+        try:
+            barrier.wait()
+        except threading.BrokenBarrierError:
+            for t in threads:
+                t.join()
+            print('Failed to load every instance', file=sys.stderr)
+            return 1
+
+        start = time.time()
+        for t in threads:
+            t.join()
+        elapsed = time.time() - start
+
+        total = sum(results)
+        for i, count in enumerate(results):
+            print('instance %2d (port %d): %d transactions'
+                  % (i, ports[i], count))
+        print('%d instances, %d transactions signed in %.1fs: %.1f tx/s'
+              % (args.instances, total, elapsed, total / elapsed))
+
+        if 0 in results:
+            return 1
+        return 0
+
+    finally:
+        for p in procs:
+            p.terminate()
+        for p in procs:
+            p.wait()
+        for log in logs:
+            log.close()
+        if args.keep:
+            print('Logs and flash images kept in %s' % workdir)
+        else:
+            shutil.rmtree(workdir, ignore_errors=True)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
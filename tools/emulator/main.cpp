@@ -28,6 +28,7 @@ extern "C" {
     #include "keepkey/board/u2f_types.h"
     #include "keepkey/board/resources.h"
     #include "keepkey/board/keepkey_usart.h"
+    #include "keepkey/emulator/emulator.h"
     #include "keepkey/emulator/setup.h"
     #include "keepkey/firmware/app_layout.h"
     #include "keepkey/firmware/home_sm.h"
@@ -35,14 +36,22 @@ extern "C" {
     #include "keepkey/rand/rng.h"
 }
 
+#include <chrono>
+#include <getopt.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
 
 #define APP_VERSIONS "VERSION" \
                       VERSION_STR(MAJOR_VERSION)  "." \
                       VERSION_STR(MINOR_VERSION)  "." \
                       VERSION_STR(PATCH_VERSION)
 
+/* Longest the main loop sleeps with no work queued, so the screensaver still
+ * comes on in time */
+#define MAX_IDLE_SLEEP_MS 1000
+
 /* These variables will be used by host application to read the version info */
 const char *const application_version = APP_VERSIONS;
 
@@ -51,14 +60,80 @@ static void exec(void)
     usb_poll();
     animate();
     display_refresh();
+    storage_commitPending();
 }
 
 extern "C" {
 void fsm_init(void);
 }
 
-int main(void)
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "Usage: %s [-p PORT] [-f FLASH] [-s NAME]\n"
+            "  -p, --port PORT    UDP port for the main interface; the debug link\n"
+            "                     uses PORT + 1 (default $KEEPKEY_UDP_PORT or 21324)\n"
+            "  -f, --flash FLASH  flash image file (default $KEEPKEY_FLASH_FILE or\n"
+            "                     emulator.img); \":memory:\" keeps it off disk\n"
+            "  -s, --framebuffer NAME\n"
+            "                     publish the display to shared memory object NAME\n"
+            "                     (default $KEEPKEY_FRAMEBUFFER, off if unset)\n",
+            argv0);
+}
+
+/* Lets several emulators run side by side, each on its own ports and flash
+ * image. */
+static void parse_args(int argc, char *argv[])
 {
+    static const struct option options[] = {
+        { "port",        required_argument, NULL, 'p' },
+        { "flash",       required_argument, NULL, 'f' },
+        { "framebuffer", required_argument, NULL, 's' },
+        { "help",        no_argument,       NULL, 'h' },
+        { NULL,          0,                 NULL, 0 },
+    };
+
+    int opt;
+    while((opt = getopt_long(argc, argv, "p:f:s:h", options, NULL)) != -1)
+    {
+        switch(opt)
+        {
+            case 'p':
+            {
+                char *end;
+                long port = strtol(optarg, &end, 10);
+                if(*end != '\0' || port <= 0 || port >= 65535)
+                {
+                    fprintf(stderr, "Invalid port: %s\n", optarg);
+                    exit(1);
+                }
+                emulatorSetUdpPort(port);
+                break;
+            }
+
+            case 'f':
+                emulatorSetFlashPath(optarg);
+                break;
+
+            case 's':
+                emulatorSetFramebufferName(optarg);
+                break;
+
+            case 'h':
+                usage(argv[0]);
+                exit(0);
+
+            default:
+                usage(argv[0]);
+                exit(1);
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    parse_args(argc, argv);
+
     setup();
     kk_board_init();
 
@@ -82,10 +157,27 @@ int main(void)
 
     layoutHomeForced();
 
+    auto last = std::chrono::steady_clock::now();
+
     while(1)
     {
-        delay_ms_with_callback(ONE_SEC, &exec, 1);
-        increment_idle_time(ONE_SEC);
+        exec();
+
+        /* Sleep until a host packet arrives or the next timer task (animation
+         * frame, confirm timeout, storage commit) is due */
+        uint32_t timeout = timer_next_deadline_ms();
+        if(timeout > MAX_IDLE_SLEEP_MS)
+            timeout = MAX_IDLE_SLEEP_MS;
+        if(timeout == 0)
+            timeout = 1;
+
+        emulatorSocketWait(timeout);
+        timer_advance();
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - last);
+        last += elapsed;
+        increment_idle_time(elapsed.count());
         toggle_screensaver();
     }
 
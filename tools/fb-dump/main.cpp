@@ -0,0 +1,137 @@
+// Dump frames from an emulator started with --framebuffer NAME as PGM.
+//
+//   fb-dump NAME                 current frame to stdout
+//   fb-dump --after SEQ NAME     wait for a frame newer than SEQ first
+//   fb-dump --follow NAME        every new frame, back to back, until killed
+//
+// The frame's sequence number goes to stderr, so a test can pass it back to
+// --after to wait for the screen to change.
+
+extern "C" {
+#include "keepkey/emulator/framebuffer.h"
+}
+
+#include <fcntl.h>
+#include <getopt.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+static void to_pgm(const std::vector<uint8_t> &pixels, uint16_t width,
+                   uint16_t height) {
+    std::cout << "P2\n"
+              << width << " " << height << "\n"
+              << "255\n";
+
+    for (uint16_t y = 0; y < height; y++) {
+        for (uint16_t x = 0; x < width; x++) {
+            std::cout << std::setw(4) << (int)pixels[y * width + x];
+            if (x + 1 == width)
+                std::cout << "\n";
+        }
+    }
+    std::cout.flush();
+}
+
+static const EmulatorFramebuffer *open_framebuffer(const char *name) {
+    int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0) {
+        perror("shm_open");
+        return nullptr;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(EmulatorFramebuffer)) {
+        std::cerr << name << ": not an emulator framebuffer\n";
+        close(fd);
+        return nullptr;
+    }
+
+    void *p = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) {
+        perror("mmap");
+        return nullptr;
+    }
+
+    auto fb = (const EmulatorFramebuffer *)p;
+    if (__atomic_load_n(&fb->magic, __ATOMIC_ACQUIRE) != EMULATOR_FRAMEBUFFER_MAGIC ||
+        (size_t)st.st_size < sizeof(*fb) + (size_t)fb->width * fb->height) {
+        std::cerr << name << ": not an emulator framebuffer\n";
+        return nullptr;
+    }
+
+    return fb;
+}
+
+// Copy the newest complete frame published after `after`, polling until
+// there is one.
+static uint32_t read_frame(const EmulatorFramebuffer *fb, uint32_t after,
+                           std::vector<uint8_t> *pixels) {
+    pixels->resize((size_t)fb->width * fb->height);
+
+    while (true) {
+        uint32_t seq = __atomic_load_n(&fb->sequence, __ATOMIC_ACQUIRE);
+        if ((seq & 1) || (after != UINT32_MAX && seq <= after)) {
+            usleep(1000);
+            continue;
+        }
+
+        memcpy(pixels->data(), fb->pixels, pixels->size());
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+        if (__atomic_load_n(&fb->sequence, __ATOMIC_RELAXED) == seq)
+            return seq;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    static const struct option options[] = {
+        { "after",  required_argument, nullptr, 'a' },
+        { "follow", no_argument,       nullptr, 'f' },
+        { nullptr,  0,                 nullptr, 0 },
+    };
+
+    uint32_t after = UINT32_MAX;
+    bool follow = false;
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "a:f", options, nullptr)) != -1) {
+        switch (opt) {
+        case 'a':
+            after = strtoul(optarg, nullptr, 10);
+            break;
+        case 'f':
+            follow = true;
+            break;
+        default:
+            std::cerr << "Usage: " << argv[0] << " [--after SEQ] [--follow] NAME\n";
+            return 1;
+        }
+    }
+
+    if (optind + 1 != argc) {
+        std::cerr << "Usage: " << argv[0] << " [--after SEQ] [--follow] NAME\n";
+        return 1;
+    }
+
+    const EmulatorFramebuffer *fb = open_framebuffer(argv[optind]);
+    if (!fb)
+        return 1;
+
+    std::vector<uint8_t> pixels;
+    do {
+        after = read_frame(fb, after, &pixels);
+        to_pgm(pixels, fb->width, fb->height);
+        std::cerr << after << "\n";
+    } while (follow);
+
+    return 0;
+}
@@ -64,6 +64,9 @@ static void exec(void)
     /* Attempt to animate should a screensaver be present */
     animate();
     display_refresh();
+
+    /* Write out settings changes whose coalescing window has elapsed */
+    storage_commitPending();
 }
 
 int main(void)
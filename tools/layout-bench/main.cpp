@@ -0,0 +1,85 @@
+/*
+ * Times the text layouts that dominate confirmation screens.
+ *
+ * Each screen is rendered repeatedly into the display canvas. The time per
+ * render is printed with a checksum of the canvas, so that a speedup can be
+ * checked against an unchanged rendering.
+ */
+
+extern "C" {
+#include "keepkey/board/canvas.h"
+#include "keepkey/board/keepkey_display.h"
+#include "keepkey/board/layout.h"
+#include "keepkey/board/timer.h"
+}
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+static const int ITERATIONS = 1000;
+
+// FNV-1a over the whole canvas.
+static uint32_t canvas_checksum(const Canvas *canvas) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < (size_t)canvas->width * canvas->height; i++) {
+        hash ^= canvas->buffer[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static bool canvas_blank(const Canvas *canvas) {
+    for (size_t i = 0; i < (size_t)canvas->width * canvas->height; i++) {
+        if (canvas->buffer[i] != 0)
+            return false;
+    }
+    return true;
+}
+
+static bool bench(Canvas *canvas, const char *name, const char *title,
+                  const char *body, NotificationType type) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++)
+        layout_standard_notification(title, body, type);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << std::left << std::setw(24) << name << std::right
+              << std::fixed << std::setprecision(2)
+              << std::setw(12) << elapsed.count() * 1e6 / ITERATIONS << " us"
+              << "    " << std::hex << std::setw(8) << std::setfill('0')
+              << canvas_checksum(canvas) << std::dec << std::setfill(' ') << "\n";
+
+    if (canvas_blank(canvas)) {
+        std::cerr << name << ": nothing was drawn" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main(void) {
+    kk_timer_init();
+    Canvas *canvas = display_canvas_init();
+    layout_init(canvas);
+
+    std::cout << std::left << std::setw(24) << "layout" << std::right
+              << std::setw(15) << "time/call"
+              << std::setw(12) << "checksum" << "\n";
+
+    bool ok = true;
+    ok &= bench(canvas, "address", "Confirm Address",
+                "bc1qar0srrr7xfkvy5l643lydnw9re59gtzzwf5mdq "
+                "3J98t1WpEZ73CNmQviecrnyiWrnqRhWNLy "
+                "0x5aAeb6053F3E94C9b9A09f33669435E7Ef1BeAed",
+                NOTIFICATION_INFO);
+    ok &= bench(canvas, "transaction", "Confirm Transaction",
+                "Send 0.12345678 BTC to 3J98t1WpEZ73CNmQviecrnyiWrnqRhWNLy?",
+                NOTIFICATION_REQUEST);
+    ok &= bench(canvas, "short", "Wipe Device",
+                "Do you want to erase your private keys and settings?",
+                NOTIFICATION_REQUEST);
+
+    return ok ? 0 : 1;
+}
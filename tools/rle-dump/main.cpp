@@ -1,12 +1,16 @@
 extern "C" {
 #include "keepkey/board/canvas.h"
 #include "keepkey/board/draw.h"
+#include "keepkey/board/resources.h"
 #include "keepkey/board/variant.h"
 }
 
+#include <chrono>
 #include <cstring>
 #include <iostream>
 #include <iomanip>
+#include <string>
+#include <vector>
 
 static const uint8_t confirm_icon_1_data[240] = {
     0x08, 0x00, 0xfc, 0x02, 0x11, 0x1e, 0x29, 0x02, 0x2f, 0xfc, 0x29, 0x1e, 0x11, 0x02, 0x0b, 0x00, 0xfe, 0x0d, 0x22, 0x08, 0x33, 0xfe, 0x22, 0x0d, 0x09, 0x00, 0xfe, 0x11, 0x2b, 0x0a, 0x33, 0xfe, 0x2b, 0x11, 0x07, 0x00, 0xfe, 0x0d, 0x2b, 0x05, 0x33, 0x02, 0x31, 0x05, 0x33, 0xfe, 0x2b, 0x0d, 0x05, 0x00, 0xfe, 0x02, 0x22, 0x06, 0x33, 0x02, 0x15, 0x06, 0x33, 0xfe, 0x22, 0x02, 0x04, 0x00, 0xff, 0x11, 0x06, 0x33, 0xff, 0x2b, 0x02, 0x01, 0xff, 0x2b, 0x06, 0x33, 0xff, 0x11, 0x04, 0x00, 0xff, 0x1e, 0x06, 0x33, 0xff, 0x0d, 0x02, 0x00, 0xff, 0x0d, 0x06, 0x33, 0xff, 0x1e, 0x04, 0x00, 0xff, 0x29, 0x05, 0x33, 0xff, 0x1f, 0x04, 0x00, 0xff, 0x1f, 0x05, 0x33, 0xff, 0x29, 0x04, 0x00, 0xff, 0x2f, 0x04, 0x33, 0xfe, 0x2f, 0x02, 0x04, 0x00, 0xfe, 0x02, 0x2f, 0x04, 0x33, 0xff, 0x2f, 0x04, 0x00, 0xff, 0x2f, 0x04, 0x33, 0xff, 0x11, 0x06, 0x00, 0xff, 0x15, 0x04, 0x33, 0xff, 0x2f, 0x04, 0x00, 0xff, 0x29, 0x03, 0x33, 0xff, 0x26, 0x08, 0x00, 0xff, 0x26, 0x03, 0x33, 0xff, 0x29, 0x04, 0x00, 0xff, 0x1e, 0x03, 0x33, 0xff, 0x11, 0x08, 0x07, 0xff, 0x15, 0x03, 0x33, 0xff, 0x1e, 0x04, 0x00, 0xff, 0x11, 0x10, 0x33, 0xff, 0x11, 0x04, 0x00, 0xfe, 0x02, 0x22, 0x0e, 0x33, 0xfe, 0x22, 0x02, 0x05, 0x00, 0xfe, 0x0d, 0x2b, 0x0c, 0x33, 0xfe, 0x2b, 0x0d, 0x07, 0x00, 0xfe, 0x11, 0x2b, 0x0a, 0x33, 0xfe, 0x2b, 0x11, 0x09, 0x00, 0xfe, 0x0d, 0x22, 0x08, 0x33, 0xfe, 0x22, 0x0d, 0x0b, 0x00, 0xfc, 0x02, 0x11, 0x1e, 0x29, 0x02, 0x2f, 0xfc, 0x29, 0x1e, 0x11, 0x02, 0x04, 0x00
@@ -42,11 +46,138 @@ void to_ppm(Canvas *canvas) {
     }
 }
 
+// The original per-pixel decoder, kept as a reference for --bench.
+static bool reference_draw(Canvas *canvas, const AnimationFrame *frame, bool erase) {
+    const Image *img = frame->image;
+    const uint8_t color = erase ? 0x0 : frame->color;
+
+    if (((img->w + frame->x) > canvas->width) ||
+        ((img->h + frame->y) > canvas->height))
+        return false;
+
+    int8_t sequence = 0;
+    int8_t nonsequence = 0;
+    uint32_t pixel_index = 0;
+
+    for (int y0 = 0; y0 < img->h; y0++) {
+        for (int x0 = 0; x0 < img->w; x0++) {
+            if (pixel_index >= img->length)
+                return false;
+
+            if ((sequence == 0) && (nonsequence == 0)) {
+                sequence = img->data[pixel_index];
+                pixel_index++;
+
+                if (sequence < 0) {
+                    nonsequence = -sequence;
+                    sequence = 0;
+                }
+            }
+
+            if (pixel_index >= img->length)
+                return false;
+
+            const uint32_t canvas_index = ((frame->y + y0) * canvas->width) + frame->x + x0;
+            canvas->buffer[canvas_index] = (uint8_t)((int)img->data[pixel_index] * color / 100);
+
+            if (sequence > 0) {
+                sequence--;
+                if (sequence == 0)
+                    pixel_index++;
+            } else {
+                if (nonsequence == 0)
+                    return false;
+                pixel_index++;
+                nonsequence--;
+            }
+        }
+    }
+
+    return true;
+}
+
+struct BenchCanvas {
+    std::vector<uint8_t> buffer;
+    Canvas canvas;
+
+    BenchCanvas() : buffer(64 * 256) {
+        canvas.buffer = &buffer[0];
+        canvas.height = 64;
+        canvas.width = 256;
+        canvas.dirty = false;
+    }
+};
+
+template <typename Draw>
+static double time_draw(Draw draw, Canvas *canvas, const AnimationFrame *frame) {
+    const int iterations = 2000;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+        draw(canvas, frame, false);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+}
+
+static bool bench_frame(const std::string &name, const AnimationFrame *frame) {
+    BenchCanvas ref, span;
+
+    bool ref_ok = reference_draw(&ref.canvas, frame, false);
+    bool span_ok = draw_bitmap_mono_rle(&span.canvas, frame, false);
+    bool match = ref_ok == span_ok && ref.buffer == span.buffer;
+
+    double ref_ns = time_draw(reference_draw, &ref.canvas, frame);
+    double span_ns = time_draw(draw_bitmap_mono_rle, &span.canvas, frame);
+
+    std::cout << std::left << std::setw(24) << name << std::right
+              << std::setw(4) << frame->image->w << "x"
+              << std::left << std::setw(4) << frame->image->h << std::right
+              << std::fixed << std::setprecision(0)
+              << std::setw(10) << ref_ns << " ns"
+              << std::setw(10) << span_ns << " ns"
+              << std::setprecision(1)
+              << std::setw(8) << ref_ns / span_ns << "x"
+              << (match ? "" : "  MISMATCH") << "\n";
+
+    return match;
+}
+
+static bool bench_animation(const std::string &name, const VariantAnimation *animation) {
+    bool match = true;
+    for (int i = 0; i < animation->count; i++)
+        match &= bench_frame(name + "[" + std::to_string(i) + "]", &animation->frames[i]);
+    return match;
+}
+
+static int bench(void) {
+    std::cout << std::left << std::setw(33) << "image" << std::right
+              << std::setw(13) << "reference"
+              << std::setw(13) << "span"
+              << std::setw(9) << "speedup" << "\n";
+
+    bool match = true;
+    match &= bench_frame("confirm_icon", get_confirm_icon_frame());
+    match &= bench_frame("confirmed", get_confirmed_frame());
+    match &= bench_frame("unplug", get_unplug_frame());
+    match &= bench_frame("recovery", get_recovery_frame());
+    match &= bench_frame("warning", get_warning_frame());
+    match &= bench_animation("confirming", get_confirming_animation());
+    match &= bench_animation("loading", get_loading_animation());
+    match &= bench_animation("warning_anim", get_warning_animation());
+    match &= bench_animation("logo", variant_getLogo(false));
+    match &= bench_animation("logo_reversed", variant_getLogo(true));
+
+    return match ? 0 : 3;
+}
+
 int main(int argc, char *argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--bench")
+        return bench();
+
     Canvas canvas;
     canvas.height = 64;
     canvas.width = 256;
     canvas.buffer = new uint8_t[64 * 255];
+    canvas.dirty = false;
 
     memset(canvas.buffer, 0, 64 * 255);
 
@@ -0,0 +1,665 @@
+/*
+ * Benchmarks the Bitcoin-family signing state machine in signing.c.
+ *
+ * Synthetic transactions are driven through signing_init()/signing_txack()
+ * in-process, the way a host wallet would answer each TxRequest. The
+ * firmware's replies are captured from the in-process transport, and its
+ * confirmations are answered with ButtonAck and DebugLinkDecision, so the
+ * tool needs an emulator build with the debug link.
+ *
+ * Before timing a workload, it is signed with several batch sizes and flush
+ * intervals, and the serialized transaction must come out identical each
+ * time.
+ *
+ * hasher_Update/hasher_Final/hasher_Raw are wrapped at link time to count
+ * the hashing each transaction costs.
+ */
+
+extern "C" {
+#include "keepkey/board/keepkey_board.h"
+#include "keepkey/board/usb_driver.h"
+#include "keepkey/emulator/emulator.h"
+#include "keepkey/emulator/inproc.h"
+#include "keepkey/emulator/setup.h"
+#include "keepkey/firmware/coins.h"
+#include "keepkey/firmware/fsm.h"
+#include "keepkey/firmware/signing.h"
+#include "keepkey/firmware/storage.h"
+#include "keepkey/firmware/transaction.h"
+#include "trezor/crypto/bip32.h"
+#include "trezor/crypto/curves.h"
+#include "trezor/crypto/hasher.h"
+#include "messages.pb.h"
+#include "pb_decode.h"
+}
+
+#include <chrono>
+#include <cstring>
+#include <getopt.h>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#define H(X) (0x80000000 | (X))
+
+static const uint64_t INPUT_AMOUNT = 100000;
+static const uint64_t FEE_PER_INPUT = 1000;
+
+struct Counters {
+    uint64_t messages;
+    uint64_t round_trips;
+    uint64_t chunks;
+    uint64_t digests;
+    uint64_t hashed_bytes;
+};
+
+static Counters counters;
+static uint32_t batch_size = 1;
+static uint32_t flush_interval = 0;
+
+extern "C" {
+void __real_hasher_Update(Hasher *hasher, const uint8_t *data, size_t length);
+void __real_hasher_Final(Hasher *hasher, uint8_t hash[HASHER_DIGEST_LENGTH]);
+void __real_hasher_Raw(HasherType type, const uint8_t *data, size_t length,
+                       uint8_t hash[HASHER_DIGEST_LENGTH]);
+
+void __wrap_hasher_Update(Hasher *hasher, const uint8_t *data, size_t length) {
+    counters.hashed_bytes += length;
+    __real_hasher_Update(hasher, data, length);
+}
+
+void __wrap_hasher_Final(Hasher *hasher, uint8_t hash[HASHER_DIGEST_LENGTH]) {
+    counters.digests++;
+    __real_hasher_Final(hasher, hash);
+}
+
+void __wrap_hasher_Raw(HasherType type, const uint8_t *data, size_t length,
+                       uint8_t hash[HASHER_DIGEST_LENGTH]) {
+    counters.digests++;
+    counters.hashed_bytes += length;
+    __real_hasher_Raw(type, data, length, hash);
+}
+}
+
+/* === Transport =========================================================== */
+
+static void queue_message(int iface, uint16_t id, const std::string &payload) {
+    emulatorInprocSendMessage(iface, id, payload.data(), payload.size());
+    counters.messages++;
+}
+
+static struct {
+    bool open;
+    uint16_t id;
+    uint32_t len;
+    std::string payload;
+} reply;
+
+static TxRequest request;
+static bool have_request;
+static std::string failure;
+static std::string serialized;
+
+static void on_message(uint16_t id, const std::string &payload) {
+    counters.messages++;
+
+    pb_istream_t stream = pb_istream_from_buffer((const uint8_t *)payload.data(),
+                                                 payload.size());
+    switch (id) {
+    case MessageType_MessageType_ButtonRequest:
+        // Press the button as soon as it's asked for.
+        queue_message(INPROC_IFACE_MAIN, MessageType_MessageType_ButtonAck, "");
+        queue_message(INPROC_IFACE_DEBUG, MessageType_MessageType_DebugLinkDecision,
+                      std::string("\x08\x01", 2));
+        break;
+
+    case MessageType_MessageType_TxRequest:
+        counters.round_trips++;
+        memset(&request, 0, sizeof(request));
+        if (pb_decode(&stream, TxRequest_fields, &request)) {
+            have_request = true;
+            if (request.has_serialized && request.serialized.has_serialized_tx) {
+                counters.chunks++;
+                serialized.append((const char *)request.serialized.serialized_tx.bytes,
+                                  request.serialized.serialized_tx.size);
+            }
+        } else {
+            failure = "undecodable TxRequest";
+        }
+        break;
+
+    case MessageType_MessageType_Failure: {
+        Failure msg;
+        memset(&msg, 0, sizeof(msg));
+        pb_decode(&stream, Failure_fields, &msg);
+        failure = msg.has_message ? msg.message : "Failure";
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+// Reassemble the firmware's reports into messages as they are sent.
+static void on_report(int iface, const uint8_t *report, size_t size, void *context) {
+    (void)context;
+    if (iface != INPROC_IFACE_MAIN || size < 1 || report[0] != '?')
+        return;
+
+    if (!reply.open) {
+        if (size < 9 || report[1] != '#' || report[2] != '#')
+            return;
+        reply.id = (report[3] << 8) | report[4];
+        reply.len = ((uint32_t)report[5] << 24) | (report[6] << 16) |
+                    (report[7] << 8) | report[8];
+        reply.payload.assign((const char *)report + 9,
+                             std::min<size_t>(reply.len, size - 9));
+        reply.open = true;
+    } else {
+        reply.payload.append((const char *)report + 1,
+                             std::min<size_t>(size - 1, reply.len - reply.payload.size()));
+    }
+
+    if (reply.payload.size() >= reply.len) {
+        reply.open = false;
+        on_message(reply.id, reply.payload);
+    }
+}
+
+static void boot(void) {
+    emulatorSetFlashPath(":memory:");
+    setup();
+    kk_board_init();
+    storage_init();
+    fsm_init();
+    usb_init();
+    emulatorInprocSetTxHook(on_report, NULL);
+}
+
+/* === Workloads =========================================================== */
+
+struct Workload {
+    const char *name;
+    const CoinType *coin;
+    const HDNode *root;
+    uint32_t purpose;
+    InputScriptType input_type;
+    OutputScriptType change_type;
+    bool overwintered;
+    bool mixed;  // every other input is native segwit
+};
+
+// Every input spends output 0 of its own previous transaction.
+struct Tx {
+    SignTx sign;
+    std::vector<TxInputType> inputs;
+    std::vector<TxOutputType> outputs;
+    std::map<std::string, uint32_t> prev_by_hash;
+};
+
+static bool segwit_input(const Workload &w, uint32_t i) {
+    return w.mixed && (i & 1);
+}
+
+static bool needs_prevtx(const Workload &w, uint32_t i) {
+    return w.input_type == InputScriptType_SPENDADDRESS && !w.overwintered &&
+           !w.coin->force_bip143 && !segwit_input(w, i);
+}
+
+static uint32_t prev_version(const Workload &w) {
+    return w.coin->decred ? 1 : 2;
+}
+
+static void prev_input(uint32_t i, TxInputType *input) {
+    memset(input, 0, sizeof(*input));
+    input->prev_hash.size = 32;
+    memset(input->prev_hash.bytes, 0xa5, 32);
+    memcpy(input->prev_hash.bytes, &i, sizeof(i));
+    input->prev_index = 1;
+    input->script_sig.size = 107;
+    memset(input->script_sig.bytes, 0x51, 107);
+    input->has_sequence = true;
+    input->sequence = 0xffffffff;
+}
+
+static void prev_output(uint32_t i, uint32_t n, TxOutputBinType *output) {
+    memset(output, 0, sizeof(*output));
+    output->amount = n == 0 ? INPUT_AMOUNT : 1000000 + i;
+    output->script_pubkey.size = 25;
+    memset(output->script_pubkey.bytes, 0x76 + n, 25);
+}
+
+// Hash a previous transaction the way the firmware will when it is streamed.
+static void prev_hash(const Workload &w, uint32_t i, uint8_t hash[32]) {
+    const curve_info *curve = get_curve_by_name(w.coin->curve_name);
+    TxStruct tx;
+    tx_init(&tx, 1, 2, prev_version(w), 0, 0, 0, curve->hasher_sign, false, 0);
+    if (w.coin->decred) {
+        tx.version |= (DECRED_SERIALIZE_NO_WITNESS << 16);
+        tx.is_decred = true;
+    }
+
+    TxInputType input;
+    prev_input(i, &input);
+    tx_serialize_input_hash(&tx, &input);
+    for (uint32_t n = 0; n < 2; n++) {
+        TxOutputBinType output;
+        prev_output(i, n, &output);
+        tx_serialize_output_hash(&tx, &output);
+    }
+    tx_hash_final(&tx, hash, true);
+}
+
+static void build_tx(const Workload &w, uint32_t inputs_count, Tx *tx) {
+    memset(&tx->sign, 0, sizeof(tx->sign));
+    tx->sign.inputs_count = inputs_count;
+    tx->sign.outputs_count = 2;
+    tx->sign.has_version = true;
+    tx->sign.version = w.overwintered ? 3 : 1;
+    tx->sign.has_lock_time = true;
+    if (w.overwintered) {
+        tx->sign.has_overwintered = true;
+        tx->sign.overwintered = true;
+        tx->sign.has_version_group_id = true;
+        tx->sign.version_group_id = w.coin->version_group_id;
+        tx->sign.has_expiry = true;
+    }
+    if (batch_size > 1) {
+        tx->sign.has_batch_size = true;
+        tx->sign.batch_size = batch_size;
+    }
+    if (flush_interval > 1) {
+        tx->sign.has_flush_interval = true;
+        tx->sign.flush_interval = flush_interval;
+    }
+
+    tx->inputs.resize(inputs_count);
+    tx->prev_by_hash.clear();
+    for (uint32_t i = 0; i < inputs_count; i++) {
+        TxInputType *input = &tx->inputs[i];
+        memset(input, 0, sizeof(*input));
+        input->address_n_count = 5;
+        input->address_n[0] = H(segwit_input(w, i) ? 84 : w.purpose);
+        input->address_n[1] = w.coin->bip44_account_path;
+        input->address_n[2] = H(0);
+        input->address_n[3] = 0;
+        input->address_n[4] = i;
+        input->prev_hash.size = 32;
+        input->has_script_type = true;
+        input->script_type = segwit_input(w, i) ? InputScriptType_SPENDWITNESS : w.input_type;
+        input->has_sequence = true;
+        input->sequence = 0xffffffff;
+        input->has_decred_tree = w.coin->decred;
+
+        if (needs_prevtx(w, i)) {
+            prev_hash(w, i, input->prev_hash.bytes);
+            tx->prev_by_hash[std::string((const char *)input->prev_hash.bytes, 32)] = i;
+        } else {
+            memset(input->prev_hash.bytes, 0x5a, 32);
+            memcpy(input->prev_hash.bytes, &i, sizeof(i));
+            input->has_amount = true;
+            input->amount = INPUT_AMOUNT;
+        }
+    }
+
+    uint64_t total = inputs_count * INPUT_AMOUNT;
+    uint64_t spend = total / 2;
+
+    // One payment, confirmed on screen, and one change output, which isn't.
+    tx->outputs.resize(2);
+    TxOutputType *pay = &tx->outputs[0];
+    memset(pay, 0, sizeof(*pay));
+    pay->address_n_count = 5;
+    pay->address_n[0] = H(44);
+    pay->address_n[1] = w.coin->bip44_account_path;
+    pay->address_n[2] = H(1);
+    pay->address_n[3] = 0;
+    pay->address_n[4] = 0;
+    pay->amount = spend;
+    pay->script_type = OutputScriptType_PAYTOADDRESS;
+
+    TxOutputType *change = &tx->outputs[1];
+    memset(change, 0, sizeof(*change));
+    change->address_n_count = 5;
+    change->address_n[0] = H(w.purpose);
+    change->address_n[1] = w.coin->bip44_account_path;
+    change->address_n[2] = H(0);
+    change->address_n[3] = 1;
+    change->address_n[4] = 0;
+    change->amount = total - spend - inputs_count * FEE_PER_INPUT;
+    change->script_type = w.change_type;
+}
+
+// Answer a TxRequest the way a host wallet would.
+static bool build_ack(const Workload &w, const Tx &tx, const TxRequest &req,
+                      TransactionType *ack) {
+    memset(ack, 0, sizeof(*ack));
+    uint32_t index = req.details.request_index;
+
+    uint32_t prev = 0;
+    bool from_prev = req.details.has_tx_hash;
+    if (from_prev) {
+        auto it = tx.prev_by_hash.find(std::string((const char *)req.details.tx_hash.bytes,
+                                                   req.details.tx_hash.size));
+        if (it == tx.prev_by_hash.end())
+            return false;
+        prev = it->second;
+    }
+
+    switch (req.request_type) {
+    case RequestType_TXMETA:
+        ack->has_version = true;
+        ack->version = prev_version(w);
+        ack->has_lock_time = true;
+        ack->has_inputs_cnt = true;
+        ack->inputs_cnt = 1;
+        ack->has_outputs_cnt = true;
+        ack->outputs_cnt = 2;
+        ack->has_expiry = w.coin->decred;
+        return from_prev;
+
+    case RequestType_TXINPUT:
+        ack->inputs_count = 1;
+        if (from_prev) {
+            prev_input(prev, &ack->inputs[0]);
+            return true;
+        }
+        if (index >= tx.inputs.size())
+            return false;
+        ack->inputs[0] = tx.inputs[index];
+        return true;
+
+    case RequestType_TXOUTPUT:
+        if (from_prev) {
+            ack->bin_outputs_count = 1;
+            prev_output(prev, index, &ack->bin_outputs[0]);
+            return index < 2;
+        }
+        if (index >= tx.outputs.size())
+            return false;
+        ack->outputs_count = 1;
+        ack->outputs[0] = tx.outputs[index];
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+// Sign one transaction, start to TXFINISHED.
+static bool sign(const Workload &w, Tx *tx) {
+    static TxRequest req;
+    static TransactionType ack;
+
+    reply.open = false;
+    have_request = false;
+    failure.clear();
+    serialized.clear();
+    counters.messages++;
+    signing_init(&tx->sign, w.coin, w.root);
+
+    while (true) {
+        if (!failure.empty()) {
+            std::cerr << w.name << ": " << failure << std::endl;
+            signing_abort();
+            return false;
+        }
+        if (!have_request) {
+            std::cerr << w.name << ": no TxRequest" << std::endl;
+            signing_abort();
+            return false;
+        }
+        have_request = false;
+
+        if (request.request_type == RequestType_TXFINISHED)
+            return true;
+
+        // Answer the whole batch without waiting in between.
+        req = request;
+        uint32_t count = req.details.has_request_count ? req.details.request_count : 1;
+        for (uint32_t i = 0; i < count && failure.empty(); i++) {
+            if (have_request) {
+                std::cerr << w.name << ": TxRequest in the middle of a batch" << std::endl;
+                signing_abort();
+                return false;
+            }
+            if (!build_ack(w, *tx, req, &ack)) {
+                std::cerr << w.name << ": unexpected TxRequest type "
+                          << req.request_type << std::endl;
+                signing_abort();
+                return false;
+            }
+
+            counters.messages++;
+            signing_txack(&ack);
+            req.details.request_index++;
+        }
+    }
+}
+
+// The batch size and flush interval only change how many TxRequests carry the
+// serialized transaction, never its bytes.
+static bool verify(const Workload &w, uint32_t inputs_count) {
+    static Tx tx;
+    const uint32_t saved_batch_size = batch_size, saved_flush_interval = flush_interval;
+    const struct {
+        uint32_t batch_size;
+        uint32_t flush_interval;
+    } settings[] = {
+        { 1, 0 },
+        { 7, 0 },
+        { 1, 3 },
+        { 7, 3 },
+        { saved_batch_size, saved_flush_interval },
+    };
+
+    std::string reference;
+    bool ok = true;
+    for (const auto &setting : settings) {
+        batch_size = setting.batch_size;
+        flush_interval = setting.flush_interval;
+        build_tx(w, inputs_count, &tx);
+        if (!sign(w, &tx)) {
+            ok = false;
+            break;
+        }
+
+        if (&setting == &settings[0]) {
+            reference = serialized;
+        } else if (serialized != reference) {
+            std::cerr << w.name << "/" << inputs_count << ": serialized tx with batch size "
+                      << setting.batch_size << " and flush interval " << setting.flush_interval
+                      << " differs from batch size 1 without flushing" << std::endl;
+            ok = false;
+        }
+    }
+
+    batch_size = saved_batch_size;
+    flush_interval = saved_flush_interval;
+    return ok;
+}
+
+static bool bench(const Workload &w, uint32_t inputs_count, double min_time) {
+    static Tx tx;
+    build_tx(w, inputs_count, &tx);
+
+    // Warm up, and make sure the workload is accepted at all.
+    if (!sign(w, &tx))
+        return false;
+
+    memset(&counters, 0, sizeof(counters));
+    uint64_t iterations = 0;
+    std::chrono::duration<double> elapsed(0);
+    auto start = std::chrono::steady_clock::now();
+    do {
+        if (!sign(w, &tx))
+            return false;
+        iterations++;
+        elapsed = std::chrono::steady_clock::now() - start;
+    } while (elapsed.count() < min_time);
+
+    double per_input = (double)iterations * inputs_count;
+    std::ostringstream name;
+    name << "BM_SignTx/" << w.name << "/" << inputs_count;
+
+    std::cout << std::left << std::setw(32) << name.str() << std::right
+              << std::fixed << std::setprecision(1)
+              << std::setw(12) << elapsed.count() * 1e6 / per_input << " us"
+              << std::setw(12) << iterations
+              << std::setw(12) << counters.messages / per_input
+              << std::setw(12) << counters.round_trips / per_input
+              << std::setw(14) << counters.chunks / per_input
+              << std::setw(12) << counters.digests / per_input
+              << std::setw(14) << counters.hashed_bytes / per_input << "\n";
+    return true;
+}
+
+/* === Main ================================================================ */
+
+static void usage(const char *argv0) {
+    fprintf(stderr,
+            "Usage: %s [-f FILTER] [-n COUNTS] [-t SECONDS] [-b SIZE] [-s N]\n"
+            "  -f, --filter FILTER   only run workloads whose name contains FILTER\n"
+            "  -n, --inputs COUNTS   comma separated input counts (default 1,10,100,500)\n"
+            "  -t, --min-time SECS   minimum time spent on each benchmark (default 0.5)\n"
+            "  -b, --batch SIZE      ask for up to SIZE TxAcks per TxRequest (default 1)\n"
+            "  -s, --flush N         hold serialized chunks back to every Nth TxRequest\n",
+            argv0);
+}
+
+int main(int argc, char *argv[]) {
+    static const struct option options[] = {
+        { "filter",   required_argument, NULL, 'f' },
+        { "inputs",   required_argument, NULL, 'n' },
+        { "min-time", required_argument, NULL, 't' },
+        { "batch",    required_argument, NULL, 'b' },
+        { "flush",    required_argument, NULL, 's' },
+        { "help",     no_argument,       NULL, 'h' },
+        { NULL,       0,                 NULL, 0 },
+    };
+
+    std::string filter;
+    std::vector<uint32_t> input_counts = { 1, 10, 100, 500 };
+    double min_time = 0.5;
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "f:n:t:b:s:h", options, NULL)) != -1) {
+        switch (opt) {
+        case 'f':
+            filter = optarg;
+            break;
+        case 'n': {
+            input_counts.clear();
+            std::istringstream counts(optarg);
+            std::string count;
+            while (std::getline(counts, count, ',')) {
+                long n = strtol(count.c_str(), NULL, 10);
+                if (n <= 0) {
+                    fprintf(stderr, "Invalid input count: %s\n", count.c_str());
+                    return 1;
+                }
+                input_counts.push_back(n);
+            }
+            break;
+        }
+        case 't':
+            min_time = strtod(optarg, NULL);
+            break;
+        case 'b':
+            batch_size = strtoul(optarg, NULL, 10);
+            if (batch_size == 0) {
+                fprintf(stderr, "Invalid batch size: %s\n", optarg);
+                return 1;
+            }
+            break;
+        case 's':
+            flush_interval = strtoul(optarg, NULL, 10);
+            if (flush_interval == 0) {
+                fprintf(stderr, "Invalid flush interval: %s\n", optarg);
+                return 1;
+            }
+            break;
+        case 'h':
+            usage(argv[0]);
+            return 0;
+        default:
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    boot();
+
+    static const uint8_t seed[64] = { 0x6b, 0x6b };
+    static HDNode root, decred_root;
+    hdnode_from_seed(seed, sizeof(seed), SECP256K1_NAME, &root);
+    hdnode_fill_public_key(&root);
+
+    // There is no Decred entry in the coin table, so derive one from
+    // Bitcoin's. Its curve hashes with BLAKE-256; without that curve the
+    // workload would not be Decred's, so it is skipped.
+    static CoinType decred = *coinByName("Bitcoin");
+    strcpy(decred.coin_name, "Decred");
+    strcpy(decred.coin_shortcut, "DCR");
+    decred.address_type = 0x073f;
+    decred.address_type_p2sh = 0x071a;
+    decred.bip44_account_path = H(42);
+    decred.maxfee_kb = 1000000000;
+    decred.segwit = false;
+    decred.has_bech32_prefix = false;
+    decred.has_decred = true;
+    decred.decred = true;
+    strcpy(decred.curve_name, "secp256k1-decred");
+    bool have_decred = get_curve_by_name(decred.curve_name) &&
+                       hdnode_from_seed(seed, sizeof(seed), decred.curve_name, &decred_root);
+    if (have_decred)
+        hdnode_fill_public_key(&decred_root);
+
+    const CoinType *bitcoin = coinByName("Bitcoin");
+    const CoinType *zcash = coinByName("ZCash");
+
+    const Workload workloads[] = {
+        { "legacy",      bitcoin, &root,        44, InputScriptType_SPENDADDRESS,
+          OutputScriptType_PAYTOADDRESS,        false },
+        { "p2sh-segwit", bitcoin, &root,        49, InputScriptType_SPENDP2SHWITNESS,
+          OutputScriptType_PAYTOP2SHWITNESS,    false },
+        { "segwit",      bitcoin, &root,        84, InputScriptType_SPENDWITNESS,
+          OutputScriptType_PAYTOWITNESS,        false },
+        { "mixed",       bitcoin, &root,        44, InputScriptType_SPENDADDRESS,
+          OutputScriptType_PAYTOADDRESS,        false, true },
+        { "zcash",       zcash,   &root,        44, InputScriptType_SPENDADDRESS,
+          OutputScriptType_PAYTOADDRESS,        true },
+        { "decred",      &decred, &decred_root, 44, InputScriptType_SPENDADDRESS,
+          OutputScriptType_PAYTOADDRESS,        false },
+    };
+
+    std::cout << std::left << std::setw(32) << "Benchmark" << std::right
+              << std::setw(15) << "Time/input"
+              << std::setw(12) << "Iterations"
+              << std::setw(12) << "Msgs/input"
+              << std::setw(12) << "Trips/input"
+              << std::setw(14) << "Chunks/input"
+              << std::setw(12) << "Hash/input"
+              << std::setw(14) << "Bytes/input" << "\n";
+
+    bool ok = true;
+    for (const Workload &w : workloads) {
+        if (std::string(w.name).find(filter) == std::string::npos)
+            continue;
+        if (w.coin == &decred && !have_decred) {
+            std::cout << "BM_SignTx/" << w.name << ": skipped, no "
+                      << decred.curve_name << " curve in trezor-crypto\n";
+            continue;
+        }
+        for (uint32_t inputs_count : { 1, 4 })
+            ok &= verify(w, inputs_count);
+        for (uint32_t inputs_count : input_counts)
+            ok &= bench(w, inputs_count, min_time);
+    }
+
+    return ok ? 0 : 2;
+}
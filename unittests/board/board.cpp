@@ -1,4 +1,5 @@
 extern "C" {
+#include "keepkey/board/font.h"
 #include "keepkey/board/keepkey_board.h"
 #include "keepkey/board/u2f.h"
 }
@@ -21,3 +22,24 @@ TEST(Board, U2FChannel) {
     ASSERT_TRUE(memcmp(c, channel, 4) == 0)
         << "Channel shouldn't change when u2f_get_channel() is called again";
 }
+
+TEST(Board, FontLookup) {
+    const Font *fonts[] = { get_pin_font(), get_title_font(), get_body_font() };
+
+    for (const Font *font : fonts) {
+        for (int c = -128; c < 128; c++) {
+            const CharacterImage *expected = nullptr;
+            for (int i = 0; i < font->length; i++) {
+                if (font->characters[i].code == c) {
+                    expected = font->characters[i].image;
+                    break;
+                }
+            }
+
+            const CharacterImage *img = font_get_char(font, (char)c);
+            if (expected)
+                EXPECT_EQ(expected, img) << "code: " << c;
+            EXPECT_EQ(img->width, font_char_width(font, (char)c)) << "code: " << c;
+        }
+    }
+}
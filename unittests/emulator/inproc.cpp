@@ -0,0 +1,1232 @@
+extern "C" {
+#include "keepkey/board/keepkey_board.h"
+#include "keepkey/board/usb_driver.h"
+#include "keepkey/emulator/emulator.h"
+#include "keepkey/emulator/inproc.h"
+#include "keepkey/emulator/setup.h"
+#include "keepkey/firmware/fsm.h"
+#include "keepkey/firmware/signing.h"
+#include "keepkey/firmware/storage.h"
+#include "trezor/crypto/bip32.h"
+#include "trezor/crypto/curves.h"
+#include "trezor/crypto/sha2.h"
+#include "messages.pb.h"
+#include "pb_decode.h"
+#include "pb_encode.h"
+}
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// A fixed root node, so address tests don't pay for seed derivation.
+static void load_root_node(void) {
+    static const uint8_t seed[32] = { 0x5e, 0xed };
+    HDNode root;
+    hdnode_from_seed(seed, sizeof(seed), SECP256K1_NAME, &root);
+
+    static LoadDevice load;
+    memset(&load, 0, sizeof(load));
+    load.has_node = true;
+    storage_dumpNode(&load.node, &root);
+    storage_loadDevice(&load);
+    storage_commit();
+}
+
+static void boot(void) {
+    static bool booted = false;
+    if (booted)
+        return;
+    booted = true;
+
+    emulatorSetFlashPath(":memory:");
+    setup();
+    kk_board_init();
+    storage_init();
+    fsm_init();
+    usb_init();
+
+    load_root_node();
+}
+
+static void queue(uint16_t id, const std::string &payload) {
+    ASSERT_TRUE(emulatorInprocSendMessage(INPROC_IFACE_MAIN, id, payload.data(),
+                                          payload.size()));
+}
+
+// Queue a message and let the firmware handle everything queued so far.
+static void send(uint16_t id, const std::string &payload) {
+    queue(id, payload);
+
+    while (emulatorInprocPending(INPROC_IFACE_MAIN))
+        usb_poll();
+}
+
+// Reassemble one reply frame from the firmware's reports.
+static bool recv(uint16_t *id, std::string *payload) {
+    uint8_t report[64];
+    if (emulatorInprocRecv(INPROC_IFACE_MAIN, report, sizeof(report)) != 64 ||
+        report[0] != '?' || report[1] != '#' || report[2] != '#')
+        return false;
+
+    *id = (report[3] << 8) | report[4];
+    uint32_t len = ((uint32_t)report[5] << 24) | (report[6] << 16) |
+                   (report[7] << 8) | report[8];
+
+    payload->assign((const char *)report + 9, std::min<uint32_t>(len, 55));
+    while (payload->size() < len) {
+        if (emulatorInprocRecv(INPROC_IFACE_MAIN, report, sizeof(report)) != 64 ||
+            report[0] != '?')
+            return false;
+        payload->append((const char *)report + 1,
+                        std::min<size_t>(63, len - payload->size()));
+    }
+
+    return true;
+}
+
+// Ping { message = text }, which Success echoes back in the same field.
+static std::string ping_payload(const std::string &text) {
+    return std::string("\x0a", 1) + (char)text.size() + text;
+}
+
+TEST(Inproc, Ping) {
+    boot();
+
+    send(MessageType_MessageType_Ping, ping_payload("inproc"));
+
+    uint16_t id;
+    std::string payload;
+    ASSERT_TRUE(recv(&id, &payload));
+    EXPECT_EQ(id, MessageType_MessageType_Success);
+    EXPECT_EQ(payload, ping_payload("inproc"));
+
+    EXPECT_EQ(emulatorInprocRecv(INPROC_IFACE_MAIN, &id, sizeof(id)), 0u);
+}
+
+TEST(Inproc, Throughput) {
+    boot();
+
+    const int exchanges = 5000;
+    auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < exchanges; i++) {
+        std::string text = "ping " + std::to_string(i);
+        send(MessageType_MessageType_Ping, ping_payload(text));
+
+        uint16_t id;
+        std::string payload;
+        ASSERT_TRUE(recv(&id, &payload));
+        ASSERT_EQ(id, MessageType_MessageType_Success);
+        ASSERT_EQ(payload, ping_payload(text));
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << exchanges << " Ping/Success exchanges in " << elapsed.count()
+              << "s (" << exchanges / elapsed.count() << "/s)" << std::endl;
+}
+
+static std::string encode(const pb_field_t *fields, const void *msg) {
+    uint8_t buf[1024];
+    pb_ostream_t stream = pb_ostream_from_buffer(buf, sizeof(buf));
+    EXPECT_TRUE(pb_encode(&stream, fields, msg));
+    return std::string((const char *)buf, stream.bytes_written);
+}
+
+static bool decode(const std::string &payload, const pb_field_t *fields, void *msg) {
+    pb_istream_t stream = pb_istream_from_buffer((const uint8_t *)payload.data(),
+                                                 payload.size());
+    return pb_decode(&stream, fields, msg);
+}
+
+static void get_addresses(uint32_t start_index, uint32_t count,
+                          InputScriptType script_type, uint16_t *id,
+                          Addresses *addresses) {
+    static GetAddresses msg;
+    memset(&msg, 0, sizeof(msg));
+    const uint32_t base[] = { 0x80000000 | 49, 0x80000000, 0x80000000, 0 };
+    memcpy(msg.address_n, base, sizeof(base));
+    msg.address_n_count = 4;
+    msg.has_coin_name = true;
+    strcpy(msg.coin_name, "Bitcoin");
+    msg.start_index = start_index;
+    msg.count = count;
+    msg.has_script_type = true;
+    msg.script_type = script_type;
+
+    send(MessageType_MessageType_GetAddresses, encode(GetAddresses_fields, &msg));
+
+    std::string payload;
+    ASSERT_TRUE(recv(id, &payload));
+    memset(addresses, 0, sizeof(*addresses));
+    if (*id == MessageType_MessageType_Addresses)
+        ASSERT_TRUE(decode(payload, Addresses_fields, addresses));
+}
+
+TEST(Inproc, GetAddressesMatchesGetAddress) {
+    boot();
+
+    const InputScriptType script_types[] = {
+        InputScriptType_SPENDADDRESS,
+        InputScriptType_SPENDP2SHWITNESS,
+        InputScriptType_SPENDWITNESS,
+    };
+    // The last range ends exactly at the hardened boundary, the next one
+    // lies entirely past it.
+    const uint32_t start_indices[] = { 0, 0x7ffffff0, 0x80000000 };
+
+    for (InputScriptType script_type : script_types) {
+        for (uint32_t start_index : start_indices) {
+            uint16_t id;
+            static Addresses addresses;
+            get_addresses(start_index, 16, script_type, &id, &addresses);
+            ASSERT_EQ(id, MessageType_MessageType_Addresses)
+                << "start_index: " << start_index;
+            ASSERT_EQ(addresses.address_count, 16u);
+
+            for (uint32_t i = 0; i < addresses.address_count; i++) {
+                static GetAddress msg;
+                memset(&msg, 0, sizeof(msg));
+                const uint32_t path[] = { 0x80000000 | 49, 0x80000000, 0x80000000, 0,
+                                          start_index + i };
+                memcpy(msg.address_n, path, sizeof(path));
+                msg.address_n_count = 5;
+                msg.has_coin_name = true;
+                strcpy(msg.coin_name, "Bitcoin");
+                msg.has_script_type = true;
+                msg.script_type = script_type;
+
+                send(MessageType_MessageType_GetAddress, encode(GetAddress_fields, &msg));
+
+                std::string payload;
+                ASSERT_TRUE(recv(&id, &payload));
+                ASSERT_EQ(id, MessageType_MessageType_Address);
+                static Address address;
+                memset(&address, 0, sizeof(address));
+                ASSERT_TRUE(decode(payload, Address_fields, &address));
+                EXPECT_STREQ(addresses.address[i], address.address)
+                    << "script_type: " << script_type << " index: " << start_index + i;
+            }
+        }
+    }
+}
+
+TEST(Inproc, GetAddressesRejectsHardenedCrossing) {
+    boot();
+
+    const struct {
+        uint32_t start_index;
+        uint32_t count;
+    } ranges[] = {
+        { 0x7ffffff1, 16 },  // runs one past the last non-hardened index
+        { 0x7fffffff, 2 },
+        { 0xfffffff1, 16 },  // wraps around from hardened to index 0
+    };
+
+    for (const auto &range : ranges) {
+        uint16_t id;
+        static Addresses addresses;
+        get_addresses(range.start_index, range.count, InputScriptType_SPENDADDRESS,
+                      &id, &addresses);
+        EXPECT_EQ(id, MessageType_MessageType_Failure)
+            << "start_index: " << range.start_index << " count: " << range.count;
+    }
+}
+
+// A legacy previous transaction, spent at output 1. Its counts and script
+// lengths use every varint width, and one input script is empty.
+static const uint64_t RAW_PREV_AMOUNT = 123456789;
+
+static std::string raw_prev_tx(void) {
+    std::string tx("\x01\x00\x00\x00", 4);
+
+    tx += std::string("\xfd\x02\x00", 3);  // 2 inputs
+    tx += std::string(32, '\x11') + std::string("\x00\x00\x00\x00", 4);
+    tx += std::string("\xfd\x2c\x01", 3) + std::string(300, '\x51');
+    tx += std::string("\xff\xff\xff\xff", 4);
+    tx += std::string(32, '\x22') + std::string("\x01\x00\x00\x00", 4);
+    tx += std::string("\x00", 1);
+    tx += std::string("\xfe\xff\xff\xff", 4);
+
+    tx += std::string("\xfe\x03\x00\x00\x00", 5);  // 3 outputs
+    tx += std::string("\x50\xc3\x00\x00\x00\x00\x00\x00", 8);
+    tx += std::string("\xff\x19\x00\x00\x00\x00\x00\x00\x00", 9) + std::string(25, '\x76');
+    for (int i = 0; i < 8; i++)
+        tx += (char)(RAW_PREV_AMOUNT >> (8 * i));
+    tx += std::string("\x19", 1) + std::string(25, '\xa9');
+    tx += std::string("\x70\x11\x01\x00\x00\x00\x00\x00", 8);
+    tx += std::string("\x00", 1);
+
+    tx += std::string("\x00\x00\x00\x00", 4);
+    return tx;
+}
+
+// txid of a serialized transaction, in the byte order TxInputType uses.
+static std::string txid(const std::string &tx) {
+    uint8_t hash[32];
+    sha256_Raw((const uint8_t *)tx.data(), tx.size(), hash);
+    sha256_Raw(hash, sizeof(hash), hash);
+    std::reverse(hash, hash + sizeof(hash));
+    return std::string((const char *)hash, sizeof(hash));
+}
+
+static void recv_request(RequestType type, TxRequest *request) {
+    uint16_t id;
+    std::string payload;
+    ASSERT_TRUE(recv(&id, &payload));
+    ASSERT_EQ(id, MessageType_MessageType_TxRequest);
+    memset(request, 0, sizeof(*request));
+    ASSERT_TRUE(decode(payload, TxRequest_fields, request));
+    ASSERT_EQ(request->request_type, type);
+}
+
+// Skip over any replies until a Failure, and return its code.
+static FailureType recv_failure(void) {
+    uint16_t id;
+    std::string payload;
+    while (recv(&id, &payload)) {
+        if (id != MessageType_MessageType_Failure)
+            continue;
+        Failure failure;
+        memset(&failure, 0, sizeof(failure));
+        EXPECT_TRUE(decode(payload, Failure_fields, &failure));
+        while (emulatorInprocRecv(INPROC_IFACE_MAIN, &id, sizeof(id)))
+            ;
+        return failure.code;
+    }
+    ADD_FAILURE() << "no Failure";
+    return (FailureType)0;
+}
+
+// Start signing one legacy input spending output 1 of prev_hash, and answer
+// up to the firmware's TXMETA request for that previous transaction.
+static void start_signing(const std::string &prev_hash) {
+    static SignTx sign;
+    memset(&sign, 0, sizeof(sign));
+    sign.inputs_count = 1;
+    sign.outputs_count = 1;
+    sign.has_coin_name = true;
+    strcpy(sign.coin_name, "Bitcoin");
+    send(MessageType_MessageType_SignTx, encode(SignTx_fields, &sign));
+
+    static TxRequest request;
+    recv_request(RequestType_TXINPUT, &request);
+
+    static TxAck ack;
+    memset(&ack, 0, sizeof(ack));
+    ack.has_tx = true;
+    ack.tx.inputs_count = 1;
+    TxInputType *input = &ack.tx.inputs[0];
+    const uint32_t path[] = { 0x80000000 | 44, 0x80000000, 0x80000000, 0, 0 };
+    memcpy(input->address_n, path, sizeof(path));
+    input->address_n_count = 5;
+    input->prev_hash.size = 32;
+    memcpy(input->prev_hash.bytes, prev_hash.data(), 32);
+    input->prev_index = 1;
+    input->has_script_type = true;
+    input->script_type = InputScriptType_SPENDADDRESS;
+    send(MessageType_MessageType_TxAck, encode(TxAck_fields, &ack));
+
+    recv_request(RequestType_TXMETA, &request);
+    ASSERT_TRUE(request.details.has_tx_hash);
+    ASSERT_EQ(std::string((const char *)request.details.tx_hash.bytes, 32), prev_hash);
+}
+
+// Hand a RawTxAck frame to the firmware in segments cut at the given offsets.
+static void raw_txack(const std::string &tx, const std::vector<size_t> &cuts) {
+    std::vector<uint8_t> frame(tx.begin(), tx.end());
+    size_t pos = 0;
+    for (size_t i = 0; i <= cuts.size(); i++) {
+        size_t end = i < cuts.size() ? cuts[i] : frame.size();
+        RawMessage msg = { frame.data() + pos, (uint32_t)(end - pos) };
+        signing_raw_txack(&msg, frame.size());
+        pos = end;
+    }
+}
+
+// Answer the only output with a change output worth amount. The firmware
+// then checks it against the amount taken from the previous transaction.
+// A Cancel is queued behind it for the final confirmation.
+static FailureType finish_signing(uint64_t amount) {
+    static TxAck ack;
+    memset(&ack, 0, sizeof(ack));
+    ack.has_tx = true;
+    ack.tx.outputs_count = 1;
+    TxOutputType *output = &ack.tx.outputs[0];
+    const uint32_t path[] = { 0x80000000 | 44, 0x80000000, 0x80000000, 1, 0 };
+    memcpy(output->address_n, path, sizeof(path));
+    output->address_n_count = 5;
+    output->amount = amount;
+    output->script_type = OutputScriptType_PAYTOADDRESS;
+
+    queue(MessageType_MessageType_TxAck, encode(TxAck_fields, &ack));
+    queue(MessageType_MessageType_Cancel, "");
+    while (emulatorInprocPending(INPROC_IFACE_MAIN))
+        usb_poll();
+
+    return recv_failure();
+}
+
+TEST(Inproc, RawTxAckEverySplit) {
+    boot();
+
+    const std::string tx = raw_prev_tx();
+    const std::string hash = txid(tx);
+
+    std::vector<std::vector<size_t>> splits = { {} };
+    for (size_t cut = 1; cut < tx.size(); cut++)
+        splits.push_back({ cut });
+    std::vector<size_t> bytewise;
+    for (size_t cut = 1; cut < tx.size(); cut++)
+        bytewise.push_back(cut);
+    splits.push_back(bytewise);
+
+    for (const auto &cuts : splits) {
+        SCOPED_TRACE(cuts.size() == 1 ? "cut at " + std::to_string(cuts[0])
+                                      : std::to_string(cuts.size()) + " cuts");
+
+        // Spending exactly the amount of output 1 only fails at the cancelled
+        // confirmation, one satoshi more is short of funds.
+        for (uint64_t amount : { RAW_PREV_AMOUNT, RAW_PREV_AMOUNT + 1 }) {
+            ASSERT_NO_FATAL_FAILURE(start_signing(hash));
+            raw_txack(tx, cuts);
+            static TxRequest request;
+            recv_request(RequestType_TXOUTPUT, &request);
+            ASSERT_FALSE(request.details.has_tx_hash);
+            EXPECT_EQ(finish_signing(amount), amount == RAW_PREV_AMOUNT
+                                                  ? FailureType_Failure_ActionCancelled
+                                                  : FailureType_Failure_NotEnoughFunds);
+        }
+    }
+}
+
+TEST(Inproc, RawTxAckOverTransport) {
+    boot();
+
+    const std::string tx = raw_prev_tx();
+    ASSERT_NO_FATAL_FAILURE(start_signing(txid(tx)));
+    send(MessageType_MessageType_RawTxAck, tx);
+
+    static TxRequest request;
+    recv_request(RequestType_TXOUTPUT, &request);
+    EXPECT_EQ(finish_signing(RAW_PREV_AMOUNT), FailureType_Failure_ActionCancelled);
+}
+
+TEST(Inproc, RawTxAckRejects) {
+    boot();
+
+    const std::string tx = raw_prev_tx();
+
+    std::string witness = tx;
+    witness.insert(4, std::string("\x00\x01", 2));
+    std::string modified = tx;
+    modified[100] ^= 1;
+
+    const struct {
+        const char *name;
+        std::string tx;
+        FailureType code;
+    } cases[] = {
+        { "witness marker", witness, FailureType_Failure_SyntaxError },
+        { "trailing byte", tx + std::string("\x00", 1), FailureType_Failure_SyntaxError },
+        { "truncated", tx.substr(0, tx.size() - 1), FailureType_Failure_SyntaxError },
+        { "hash mismatch", modified, FailureType_Failure_Other },
+    };
+
+    for (const auto &c : cases) {
+        SCOPED_TRACE(c.name);
+        ASSERT_NO_FATAL_FAILURE(start_signing(txid(tx)));
+        raw_txack(c.tx, {});
+        EXPECT_EQ(recv_failure(), c.code);
+    }
+
+    // Before the firmware asked for a previous transaction.
+    static SignTx sign;
+    memset(&sign, 0, sizeof(sign));
+    sign.inputs_count = 1;
+    sign.outputs_count = 1;
+    sign.has_coin_name = true;
+    strcpy(sign.coin_name, "Bitcoin");
+    send(MessageType_MessageType_SignTx, encode(SignTx_fields, &sign));
+    static TxRequest request;
+    recv_request(RequestType_TXINPUT, &request);
+    raw_txack(tx, {});
+    EXPECT_EQ(recv_failure(), FailureType_Failure_UnexpectedMessage);
+
+    // Signing was aborted by the previous frame.
+    raw_txack(tx, {});
+    EXPECT_EQ(recv_failure(), FailureType_Failure_UnexpectedMessage);
+}
+
+TEST(Inproc, RawTxAckAfterCutOffFrame) {
+    boot();
+
+    const std::string tx = raw_prev_tx();
+    std::vector<uint8_t> frame(tx.begin(), tx.end());
+    RawMessage half = { frame.data(), (uint32_t)frame.size() / 2 };
+
+    // Cut off by a Cancel: the next session's RawTxAck starts a new frame,
+    // rather than being taken for the rest of the old one.
+    ASSERT_NO_FATAL_FAILURE(start_signing(txid(tx)));
+    signing_raw_txack(&half, frame.size());
+    send(MessageType_MessageType_Cancel, "");
+    EXPECT_EQ(recv_failure(), FailureType_Failure_ActionCancelled);
+
+    ASSERT_NO_FATAL_FAILURE(start_signing(txid(tx)));
+    raw_txack(tx, {});
+    static TxRequest request;
+    recv_request(RequestType_TXOUTPUT, &request);
+    EXPECT_EQ(finish_signing(RAW_PREV_AMOUNT), FailureType_Failure_ActionCancelled);
+
+    // Cut off by a new SignTx.
+    ASSERT_NO_FATAL_FAILURE(start_signing(txid(tx)));
+    signing_raw_txack(&half, frame.size());
+    ASSERT_NO_FATAL_FAILURE(start_signing(txid(tx)));
+    raw_txack(tx, {});
+    recv_request(RequestType_TXOUTPUT, &request);
+    EXPECT_EQ(finish_signing(RAW_PREV_AMOUNT), FailureType_Failure_ActionCancelled);
+
+    // Cut off, then a RawTxAck outside signing is refused, not swallowed.
+    ASSERT_NO_FATAL_FAILURE(start_signing(txid(tx)));
+    signing_raw_txack(&half, frame.size());
+    send(MessageType_MessageType_Cancel, "");
+    EXPECT_EQ(recv_failure(), FailureType_Failure_ActionCancelled);
+    raw_txack(tx, {});
+    EXPECT_EQ(recv_failure(), FailureType_Failure_UnexpectedMessage);
+}
+
+// The seed job derives the BIP39 seed from this in chunks, polling the host
+// in between.
+static const char ALL_MNEMONIC[] =
+    "all all all all all all all all all all all all";
+
+// m/44'/0'/0' of ALL_MNEMONIC
+static const char ALL_ACCOUNT_XPUB[] =
+    "xpub6BiVtCpG9fQPxnPmHXG8PhtzQdWC2Su4qWu6XW9tpWFYhxydCLJGrWBJZ5H6qTAHdPQ7pQhtpjiYZVZARo14qHiay2fvrX996oEP42u8wZy";
+
+static void load_mnemonic(void) {
+    static LoadDevice load;
+    memset(&load, 0, sizeof(load));
+    load.has_mnemonic = true;
+    strncpy(load.mnemonic, ALL_MNEMONIC, sizeof(load.mnemonic) - 1);
+    storage_loadDevice(&load);
+
+    uint16_t id;
+    while (emulatorInprocRecv(INPROC_IFACE_MAIN, &id, sizeof(id)))
+        ;
+}
+
+static std::string account_public_key(void) {
+    GetPublicKey msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.address_n_count = 3;
+    msg.address_n[0] = 0x80000000 | 44;
+    msg.address_n[1] = 0x80000000 | 0;
+    msg.address_n[2] = 0x80000000 | 0;
+    return encode(GetPublicKey_fields, &msg);
+}
+
+static void expect_account_xpub(void) {
+    uint16_t id;
+    std::string payload;
+    ASSERT_TRUE(recv(&id, &payload));
+    ASSERT_EQ(id, MessageType_MessageType_PublicKey);
+
+    PublicKey key;
+    memset(&key, 0, sizeof(key));
+    ASSERT_TRUE(decode(payload, PublicKey_fields, &key));
+    EXPECT_STREQ(key.xpub, ALL_ACCOUNT_XPUB);
+}
+
+TEST(InprocSeedJob, DerivesSeed) {
+    boot();
+    load_mnemonic();
+
+    send(MessageType_MessageType_GetPublicKey, account_public_key());
+    expect_account_xpub();
+
+    // Served from the session seed the job left behind.
+    send(MessageType_MessageType_GetPublicKey, account_public_key());
+    expect_account_xpub();
+
+    load_root_node();
+}
+
+#if DEBUG_LINK
+TEST(InprocSeedJob, AnswersDebugLinkMidJob) {
+    boot();
+    load_mnemonic();
+
+    // The debug link is only read once the job polls, between chunks.
+    ASSERT_TRUE(emulatorInprocSendMessage(INPROC_IFACE_DEBUG,
+                                          MessageType_MessageType_DebugLinkGetState,
+                                          "", 0));
+    send(MessageType_MessageType_GetPublicKey, account_public_key());
+
+    uint8_t report[64];
+    ASSERT_EQ(emulatorInprocRecv(INPROC_IFACE_DEBUG, report, sizeof(report)), 64u);
+    EXPECT_EQ((report[3] << 8) | report[4], MessageType_MessageType_DebugLinkState);
+    while (emulatorInprocRecv(INPROC_IFACE_DEBUG, report, sizeof(report)))
+        ;
+
+    expect_account_xpub();
+
+    load_root_node();
+}
+#endif
+
+TEST(InprocSeedJob, CancelAbortsJob) {
+    boot();
+    load_mnemonic();
+
+    // Both are queued up front, so Cancel arrives after the first chunk.
+    queue(MessageType_MessageType_GetPublicKey, account_public_key());
+    send(MessageType_MessageType_Cancel, "");
+    EXPECT_EQ(recv_failure(), FailureType_Failure_ActionCancelled);
+
+    // Nothing of the abandoned job leaks into the next derivation.
+    send(MessageType_MessageType_GetPublicKey, account_public_key());
+    expect_account_xpub();
+
+    load_root_node();
+}
+
+TEST(InprocSeedJob, InitializeAbortsJob) {
+    boot();
+    load_mnemonic();
+
+    queue(MessageType_MessageType_GetPublicKey, account_public_key());
+    send(MessageType_MessageType_Initialize, "");
+
+    // Initialize is answered with Features, and nothing else.
+    uint16_t id;
+    std::string payload;
+    ASSERT_TRUE(recv(&id, &payload));
+    EXPECT_EQ(id, MessageType_MessageType_Features);
+    EXPECT_FALSE(recv(&id, &payload));
+
+    send(MessageType_MessageType_GetPublicKey, account_public_key());
+    expect_account_xpub();
+
+    load_root_node();
+}
+
+#if DEBUG_LINK
+
+#define H(X) (0x80000000 | (X))
+
+static std::string hex(const std::string &bytes) {
+    static const char digits[] = "0123456789abcdef";
+    std::string out;
+    for (unsigned char c : bytes) {
+        out += digits[c >> 4];
+        out += digits[c & 0xf];
+    }
+    return out;
+}
+
+// The previous transaction the legacy inputs below spend an output of.
+static void prev_input(uint32_t index, TxInputType *input) {
+    memset(input, 0, sizeof(*input));
+    input->prev_hash.size = 32;
+    memset(input->prev_hash.bytes, 0x10 + index, 32);
+    input->prev_index = index;
+    input->script_sig.size = 107;
+    memset(input->script_sig.bytes, 0x51 + index, 107);
+    input->has_sequence = true;
+    input->sequence = 0xffffffff;
+}
+
+static void prev_output(uint32_t index, TxOutputBinType *output) {
+    memset(output, 0, sizeof(*output));
+    output->amount = 400000 + 1000 * index;
+    output->script_pubkey.size = 25;
+    memset(output->script_pubkey.bytes, 0x76 + index, 25);
+}
+
+static std::string prev_hash(void) {
+    std::string tx("\x01\x00\x00\x00\x03", 5);
+    for (uint32_t i = 0; i < 3; i++) {
+        static TxInputType input;
+        prev_input(i, &input);
+        tx += std::string(input.prev_hash.bytes, input.prev_hash.bytes + 32);
+        std::reverse(tx.end() - 32, tx.end());
+        tx += std::string((const char *)&input.prev_index, 4);
+        tx += (char)input.script_sig.size;
+        tx += std::string((const char *)input.script_sig.bytes, input.script_sig.size);
+        tx += std::string((const char *)&input.sequence, 4);
+    }
+    tx += '\x03';
+    for (uint32_t i = 0; i < 3; i++) {
+        static TxOutputBinType output;
+        prev_output(i, &output);
+        tx += std::string((const char *)&output.amount, 8);
+        tx += (char)output.script_pubkey.size;
+        tx += std::string((const char *)output.script_pubkey.bytes, output.script_pubkey.size);
+    }
+    tx += std::string(4, '\x00');
+    return txid(tx);
+}
+
+// A transaction as the host wallet knows it. The expected signed
+// transactions below were computed for these inputs and outputs outside the
+// firmware, from the same root node.
+struct Wallet {
+    const char *coin_name;
+    std::vector<TxInputType> inputs;
+    std::vector<TxOutputType> outputs;
+    std::vector<TxOutputBinType> prev_outputs;
+};
+
+static TxInputType wallet_input(InputScriptType script_type,
+                                std::initializer_list<uint32_t> path, uint32_t n,
+                                uint64_t amount) {
+    TxInputType input;
+    memset(&input, 0, sizeof(input));
+    std::copy(path.begin(), path.end(), input.address_n);
+    input.address_n_count = path.size();
+    input.prev_hash.size = 32;
+    for (uint32_t i = 0; i < 32; i++)
+        input.prev_hash.bytes[i] = n * 32 + i;
+    input.prev_index = n;
+    input.has_script_type = true;
+    input.script_type = script_type;
+    input.has_amount = true;
+    input.amount = amount;
+    input.has_sequence = true;
+    input.sequence = 0xffffffff;
+    return input;
+}
+
+// A legacy input spending output 1 of the previous transaction, whose amount
+// the firmware takes from there.
+static TxInputType legacy_input(std::initializer_list<uint32_t> path) {
+    TxInputType input = wallet_input(InputScriptType_SPENDADDRESS, path, 0, 0);
+    input.has_amount = false;
+    input.amount = 0;
+    std::string hash = prev_hash();
+    memcpy(input.prev_hash.bytes, hash.data(), 32);
+    input.prev_index = 1;
+    return input;
+}
+
+static TxOutputType wallet_output(OutputScriptType script_type,
+                                  std::initializer_list<uint32_t> path, uint64_t amount) {
+    TxOutputType output;
+    memset(&output, 0, sizeof(output));
+    std::copy(path.begin(), path.end(), output.address_n);
+    output.address_n_count = path.size();
+    output.amount = amount;
+    output.script_type = script_type;
+    return output;
+}
+
+static Wallet wallet(const char *coin_name, std::vector<TxInputType> inputs,
+                     std::vector<TxOutputType> outputs) {
+    Wallet w = { coin_name, inputs, outputs, {} };
+    w.prev_outputs.resize(3);
+    for (uint32_t i = 0; i < 3; i++)
+        prev_output(i, &w.prev_outputs[i]);
+    return w;
+}
+
+// Three native segwit inputs: returned in Phase 1, signed in the witnesses.
+static Wallet native_segwit_wallet(void) {
+    std::vector<TxInputType> inputs;
+    for (uint32_t n = 0; n < 3; n++)
+        inputs.push_back(wallet_input(InputScriptType_SPENDWITNESS,
+                                      { H(84), H(0), H(0), 0, n }, n, 100000 * (n + 1)));
+    return wallet("Bitcoin", inputs,
+                  { wallet_output(OutputScriptType_PAYTOADDRESS, { H(44), H(0), H(1), 0, 0 }, 250000),
+                    wallet_output(OutputScriptType_PAYTOWITNESS, { H(84), H(0), H(0), 1, 0 }, 340000) });
+}
+
+static Wallet p2sh_segwit_wallet(uint32_t inputs_count, uint64_t amount, uint64_t pay,
+                                 uint64_t change) {
+    std::vector<TxInputType> inputs;
+    for (uint32_t n = 0; n < inputs_count; n++)
+        inputs.push_back(wallet_input(InputScriptType_SPENDP2SHWITNESS,
+                                      { H(49), H(0), H(0), 0, n }, n, amount * (n + 1)));
+    return wallet("Bitcoin", inputs,
+                  { wallet_output(OutputScriptType_PAYTOADDRESS, { H(44), H(0), H(1), 0, 0 }, pay),
+                    wallet_output(OutputScriptType_PAYTOP2SHWITNESS, { H(49), H(0), H(0), 1, 0 }, change) });
+}
+
+// Two segwit inputs returned in Phase 1, then a legacy one that Phase 2
+// resumes at.
+static Wallet mixed_wallet(void) {
+    return wallet("Bitcoin",
+                  { wallet_input(InputScriptType_SPENDWITNESS, { H(84), H(0), H(0), 0, 0 }, 0, 100000),
+                    wallet_input(InputScriptType_SPENDWITNESS, { H(84), H(0), H(0), 0, 1 }, 1, 200000),
+                    legacy_input({ H(44), H(0), H(0), 0, 0 }) },
+                  { wallet_output(OutputScriptType_PAYTOADDRESS, { H(44), H(0), H(1), 0, 0 }, 250000),
+                    wallet_output(OutputScriptType_PAYTOADDRESS, { H(44), H(0), H(0), 1, 0 }, 431000) });
+}
+
+// Bitcoin Gold signs every input with BIP143 and its fork id, so the
+// SPENDADDRESS input after the segwit one is signed in Phase 2 without its
+// previous transaction.
+static Wallet force_bip143_wallet(void) {
+    return wallet("BitcoinGold",
+                  { wallet_input(InputScriptType_SPENDWITNESS, { H(84), H(156), H(0), 0, 0 }, 0, 100000),
+                    wallet_input(InputScriptType_SPENDADDRESS, { H(44), H(156), H(0), 0, 0 }, 1, 200000) },
+                  { wallet_output(OutputScriptType_PAYTOADDRESS, { H(44), H(156), H(1), 0, 0 }, 150000),
+                    wallet_output(OutputScriptType_PAYTOADDRESS, { H(44), H(156), H(0), 1, 0 }, 140000) });
+}
+
+static const char NATIVE_SEGWIT_TX[] =
+    "020000000001031f1e1d1c1b1a191817161514131211100f0e0d0c0b0a090807060504030201000000000000ffffffff"
+    "3f3e3d3c3b3a393837363534333231302f2e2d2c2b2a292827262524232221200100000000ffffffff5f5e5d5c5b5a59"
+    "5857565554535251504f4e4d4c4b4a494847464544434241400200000000ffffffff0290d00300000000001976a9148b"
+    "399fa0ff256adfd952420fdfea5ae6a265a08988ac2030050000000000160014412969c4a892a2821659b7b878b760b3"
+    "1402ea0b0247304402204d156be5646ec13dd2f094215bb4d625cfe41f3ac717fb008964bed26de0522602200fd0acac"
+    "1fbf75956f0cb215ca57bcb926a26014ea6108e368a6365b6d8dbaae01210332ef4688f0f62aa64d9a81f6dd9217c122"
+    "94e049db3098d8a6afcabc1b1be1fd02483045022100f19c88d031620e12007b7343557ff31933457295195671aaa6f2"
+    "258524efcad602202265be3691d26ef5799251fee685be93b10f442a69f66fb4e37042da8ca763f401210377b145a694"
+    "d1ec9646927f941453de9b803149c30393bbd0d701595cacbe47db02473044022021876310761355ac02db76a8136da4"
+    "8783d5b8c0b7b66c9bf68189147ea936d402203f71c9e402009fe18f4e39732312113166d2e11e7b8ccc47e0bb366616"
+    "c3b47d012102fd8f4bc3bdfa292174c7015cd5d9e97ba1b6d29607df0f61af791ad2ff991ab511000000";
+
+static const char P2SH_SEGWIT_TX[] =
+    "020000000001031f1e1d1c1b1a191817161514131211100f0e0d0c0b0a090807060504030201000000000017160014ef"
+    "c57201fc692db85b203441bb59d3e3064739f1ffffffff3f3e3d3c3b3a393837363534333231302f2e2d2c2b2a292827"
+    "2625242322212001000000171600149091542ecb12f1f26a7fc1c72d58b05ec92e44e3ffffffff5f5e5d5c5b5a595857"
+    "565554535251504f4e4d4c4b4a494847464544434241400200000017160014cfc44c8531953fdce22f0eaa8ff2f1264e"
+    "f86abcffffffff0290d00300000000001976a9148b399fa0ff256adfd952420fdfea5ae6a265a08988ac203005000000"
+    "000017a9140ec6a3923741f4f66c080d29be980bb0114c9e3a870247304402202434c2c9dffc9c356319f4b36903493f"
+    "34e5fa3f5a3d388ea70cda57634d1a1e022052cd69139a1b343178b171f1edc7399bc8092f11a2d6612f8b143707ffca"
+    "12c0012103a9925d6bbd26d73bce446b1e080b3fefb7daacc3c74d8f470dc92b04bdfe531a02473044022045e1d96820"
+    "a0303f9ba0be930a9950660ba089fcc0341bcf19e3fce0db581d660220352c9b8910d132c96a58c5bf0604ae97cae11e"
+    "6843b1148c73408b73cac7f78d01210224e95e44d9c1a402bd2a67d148601de96176e4d2a94f7287a7465b1afdc9eb8e"
+    "0248304502210096fea36bc534dc825d72f2071efeff123820b8e190091fe9602f48fee9faf0e602201d3e31cdfdcfa9"
+    "4993dc0e13ce62cb112c6dad13ec2eab5fff2d007f8d0770d901210369aeae4890e237c2ab2f393465c27f14e78a7e20"
+    "2f1a2c08f45b747321d72b7211000000";
+
+static const char MIXED_TX[] =
+    "020000000001031f1e1d1c1b1a191817161514131211100f0e0d0c0b0a090807060504030201000000000000ffffffff"
+    "3f3e3d3c3b3a393837363534333231302f2e2d2c2b2a292827262524232221200100000000ffffffff940b80f690b81e"
+    "62b48dc69a1dcb8e6b3eb236481cd91f82ee3f36b548bd03d2010000006b483045022100b744e8833bea5cbea7dbcf9f"
+    "a25d3a80eb92043e97af9896937dcc474f6a319d022045c71e861ad6dcb99b05f0fcfc490fd02398f6b454db47c38f42"
+    "bb59216b84f101210248ccaea395dfc891912bfd264e9b6ffd7218ccd4a47e517edbcda5d6eac21ea7ffffffff0290d0"
+    "0300000000001976a9148b399fa0ff256adfd952420fdfea5ae6a265a08988ac98930600000000001976a91468330ba9"
+    "5b166459ab4f33f07e60d88a3686461088ac0247304402202b480dcb82aa8a5a90b5e1da20cfd81dfe993aae646666d6"
+    "f4284d62fad224ff022042ee148c3a441033806b079b233f617e2f07200af5066ac588aa9d089281517001210332ef46"
+    "88f0f62aa64d9a81f6dd9217c12294e049db3098d8a6afcabc1b1be1fd02483045022100d913205e82a2f11a93c7b8f4"
+    "c985dec43d6a72b365e679f5d37de06288814f6702207743e723289f2f9864e80d1b1486ba95e2004ee451bd02d71e61"
+    "d0eb9cd2373b01210377b145a694d1ec9646927f941453de9b803149c30393bbd0d701595cacbe47db0011000000";
+
+static const char FORCE_BIP143_TX[] =
+    "020000000001021f1e1d1c1b1a191817161514131211100f0e0d0c0b0a090807060504030201000000000000ffffffff"
+    "3f3e3d3c3b3a393837363534333231302f2e2d2c2b2a29282726252423222120010000006a473044022023e20c685b0e"
+    "327f728377dd7d0b79c331555fb297c3e0de278a54db2b1e28ee02203e2ee6039252a1c84f91b660ae22bfc639de9dc0"
+    "6c3ad11510a52a16f46056a8412102036a79e939b5037ace7ea4bdb0b6ec6f05c26bbde4025112413dc095a3a0a22cff"
+    "ffffff02f0490200000000001976a914fafc51f63317b3f763f480135ac81b67805731fc88ace0220200000000001976"
+    "a91461202153e5936a8613affd56adf521d22a3011f188ac02483045022100c5e31b4df92ad688271391e40b921c2367"
+    "570ef9dee61a297faa2e221cfbe77302204b800b0e7a78a3c2fb599826af9e8ae707484875e6ecb01a28405ba5d541ac"
+    "864121026e886cb3319a7ca24f66e76918fc4ac9dd0c0853d9f9d3beadc3eb231fd917d20011000000";
+
+static const char P2SH_SEGWIT_8_TX[] =
+    "020000000001081f1e1d1c1b1a191817161514131211100f0e0d0c0b0a090807060504030201000000000017160014ef"
+    "c57201fc692db85b203441bb59d3e3064739f1ffffffff3f3e3d3c3b3a393837363534333231302f2e2d2c2b2a292827"
+    "2625242322212001000000171600149091542ecb12f1f26a7fc1c72d58b05ec92e44e3ffffffff5f5e5d5c5b5a595857"
+    "565554535251504f4e4d4c4b4a494847464544434241400200000017160014cfc44c8531953fdce22f0eaa8ff2f1264e"
+    "f86abcffffffff7f7e7d7c7b7a797877767574737271706f6e6d6c6b6a6968676665646362616003000000171600147e"
+    "c39e62b646e2df945883b5d538ad14a97e66f5ffffffff9f9e9d9c9b9a999897969594939291908f8e8d8c8b8a898887"
+    "86858483828180040000001716001487a1784cb1e8990ea87d9f9cf27f6e0660158744ffffffffbfbebdbcbbbab9b8b7"
+    "b6b5b4b3b2b1b0afaeadacabaaa9a8a7a6a5a4a3a2a1a0050000001716001451b09a66548768e2afc091a02b198e152c"
+    "82ad55ffffffffdfdedddcdbdad9d8d7d6d5d4d3d2d1d0cfcecdcccbcac9c8c7c6c5c4c3c2c1c006000000171600143c"
+    "12ca942d211cf5553f7ffadb45db21b0898899fffffffffffefdfcfbfaf9f8f7f6f5f4f3f2f1f0efeeedecebeae9e8e7"
+    "e6e5e4e3e2e1e007000000171600140247cf660f5e74810427ea854493dbeec51eb104ffffffff0220a1070000000000"
+    "1976a9148b399fa0ff256adfd952420fdfea5ae6a265a08988ac50262f000000000017a9140ec6a3923741f4f66c080d"
+    "29be980bb0114c9e3a8702483045022100c638e9f361c136b4cd7a095476f8e1bc367078ef103eb7e095805fd16c5c7e"
+    "0502207e6364965b25bd73bbcade0a5186dc6916ea524ea1c3d8a5ffa90b9987958146012103a9925d6bbd26d73bce44"
+    "6b1e080b3fefb7daacc3c74d8f470dc92b04bdfe531a02483045022100f583a0d1e22ea52a3747673bac9672485d6677"
+    "81b462b4f980017cbd4657ef81022026bab91dc9e57103c9fc83a3c48ef533d87e5f07d1860c62f6a5d6c5df11d41301"
+    "210224e95e44d9c1a402bd2a67d148601de96176e4d2a94f7287a7465b1afdc9eb8e02483045022100bfebbdba7f26c2"
+    "2fc6b27b67ce489c2a87aab737bebc0626f675e0b24593db5b02203809736061fb8cbdcc8624696ee2e9e244c7eb5671"
+    "9bc223e7877c9fcda6f68a01210369aeae4890e237c2ab2f393465c27f14e78a7e202f1a2c08f45b747321d72b720248"
+    "3045022100d491564ca7bfe1942b18e27597cbed9db2fe2d2ec078deda5cdc0cc103da3aa9022020ff77e874c37fa3a7"
+    "dd13fef0e65c782eb390381f8394018c271b905c3833a601210295c80dd5e3ad7a36bbefb4809dfe7bb5ed688e85a9ee"
+    "41293d023a1fd1603b7c0247304402207579ca24dca3cf050d878f39459db2c9e2fe28a198bee306eb6d3a896601ffc6"
+    "022038c141d1974175aa3c5e8237672a571429b5d2748aa334f10ac44124124f76e7012102d022b20af2eeef8837fa45"
+    "28c6d9dfa22f90535a5406f8313226c5a63b9ebfaf0247304402203564a1eb77627bd15a56082327b03c8875f624de0b"
+    "961cf602d4b9175b83713a022067040315b5f9be0f3f68d85533758a39fa1f9fcba589bbd64c2e6da49808a807012102"
+    "67654840b3a8def83a339881fe2860ce17c2967fa28cce042ac7683eed8858db02483045022100d3e7ab9f3e833aad4d"
+    "ee643ed52e2aafa718fea70a048e89963ab44b159fcb5602200130a5fa6ed2bfd9e4e862cfd868694afd655a4bc9b2de"
+    "a954e8077c30f0e036012103843cc7b213a3c87a51ebcb53163f0e03b04299e428e7fc753e717e09e33960e002473044"
+    "022023f15ef6c13d29ad0531af279921433c0e311d4ee2b5232e2bdf4e6d8b81e65402205be193a25ba05f1f6a8cc813"
+    "11647359fc25289256339dbc2fdde601ad4f16de012103f7c16f952f3cb0f0cafa3093815e6457d9317189daf848f06b"
+    "157a28f280e29311000000";
+
+// Replies the firmware sends while signing, reassembled from its reports.
+static struct {
+    bool open;
+    uint16_t id;
+    uint32_t len;
+    std::string payload;
+} reply;
+static std::vector<std::pair<uint16_t, std::string>> replies;
+
+// Confirmations are answered as soon as they are asked for, everything else
+// is kept for the test.
+static void on_report(int iface, const uint8_t *report, size_t size, void *context) {
+    (void)context;
+    if (iface != INPROC_IFACE_MAIN || size < 1 || report[0] != '?')
+        return;
+
+    if (!reply.open) {
+        if (size < 9 || report[1] != '#' || report[2] != '#')
+            return;
+        reply.id = (report[3] << 8) | report[4];
+        reply.len = ((uint32_t)report[5] << 24) | (report[6] << 16) |
+                    (report[7] << 8) | report[8];
+        reply.payload.assign((const char *)report + 9,
+                             std::min<size_t>(reply.len, size - 9));
+        reply.open = true;
+    } else {
+        reply.payload.append((const char *)report + 1,
+                             std::min<size_t>(size - 1, reply.len - reply.payload.size()));
+    }
+    if (reply.payload.size() < reply.len)
+        return;
+    reply.open = false;
+
+    if (reply.id == MessageType_MessageType_ButtonRequest) {
+        EXPECT_TRUE(emulatorInprocSendMessage(INPROC_IFACE_MAIN,
+                                              MessageType_MessageType_ButtonAck, "", 0));
+        EXPECT_TRUE(emulatorInprocSendMessage(INPROC_IFACE_DEBUG,
+                                              MessageType_MessageType_DebugLinkDecision,
+                                              "\x08\x01", 2));
+        return;
+    }
+    replies.push_back(std::make_pair(reply.id, reply.payload));
+}
+
+// Answer element index of the stream req asks for.
+static bool answer(const Wallet &w, const TxRequest &req, uint32_t index,
+                   TransactionType *tx) {
+    memset(tx, 0, sizeof(*tx));
+    if (req.details.has_tx_hash &&
+        std::string((const char *)req.details.tx_hash.bytes, req.details.tx_hash.size) !=
+            prev_hash())
+        return false;
+
+    switch (req.request_type) {
+    case RequestType_TXMETA:
+        tx->has_version = true;
+        tx->version = 1;
+        tx->has_lock_time = true;
+        tx->has_inputs_cnt = true;
+        tx->inputs_cnt = 3;
+        tx->has_outputs_cnt = true;
+        tx->outputs_cnt = w.prev_outputs.size();
+        return req.details.has_tx_hash;
+
+    case RequestType_TXINPUT:
+        tx->inputs_count = 1;
+        if (req.details.has_tx_hash) {
+            prev_input(index, &tx->inputs[0]);
+            return index < 3;
+        }
+        if (index >= w.inputs.size())
+            return false;
+        tx->inputs[0] = w.inputs[index];
+        return true;
+
+    case RequestType_TXOUTPUT:
+        if (req.details.has_tx_hash) {
+            if (index >= w.prev_outputs.size())
+                return false;
+            tx->bin_outputs_count = 1;
+            tx->bin_outputs[0] = w.prev_outputs[index];
+            return true;
+        }
+        if (index >= w.outputs.size())
+            return false;
+        tx->outputs_count = 1;
+        tx->outputs[0] = w.outputs[index];
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+struct Signed {
+    std::vector<TxRequest> requests;
+    std::string serialized;
+    FailureType failure;
+};
+
+// Sign w over the transport the way a host wallet would, answering a batch
+// of requests with back-to-back TxAcks. True once TXFINISHED arrives.
+static bool sign_tx(const Wallet &w, uint32_t batch_size, uint32_t flush_interval,
+                    Signed *out) {
+    out->requests.clear();
+    out->serialized.clear();
+    out->failure = (FailureType)0;
+    reply.open = false;
+    replies.clear();
+    emulatorInprocSetTxHook(on_report, NULL);
+
+    static SignTx sign;
+    memset(&sign, 0, sizeof(sign));
+    sign.inputs_count = w.inputs.size();
+    sign.outputs_count = w.outputs.size();
+    sign.has_coin_name = true;
+    strcpy(sign.coin_name, w.coin_name);
+    sign.has_version = true;
+    sign.version = 2;
+    sign.has_lock_time = true;
+    sign.lock_time = 0x11;
+    sign.has_batch_size = batch_size > 1;
+    sign.batch_size = batch_size;
+    sign.has_flush_interval = flush_interval > 0;
+    sign.flush_interval = flush_interval;
+    send(MessageType_MessageType_SignTx, encode(SignTx_fields, &sign));
+
+    bool finished = false;
+    while (out->requests.size() < 1000) {
+        // Nothing may come back before the last TxAck of a batch.
+        if (replies.size() != 1) {
+            ADD_FAILURE() << replies.size() << " replies after request "
+                          << out->requests.size();
+            break;
+        }
+        std::pair<uint16_t, std::string> r = replies[0];
+        replies.clear();
+
+        if (r.first == MessageType_MessageType_Failure) {
+            Failure failure;
+            memset(&failure, 0, sizeof(failure));
+            EXPECT_TRUE(decode(r.second, Failure_fields, &failure));
+            out->failure = failure.code;
+            break;
+        }
+        static TxRequest request;
+        memset(&request, 0, sizeof(request));
+        if (r.first != MessageType_MessageType_TxRequest ||
+            !decode(r.second, TxRequest_fields, &request)) {
+            ADD_FAILURE() << "unexpected reply " << r.first;
+            break;
+        }
+        out->requests.push_back(request);
+        if (request.has_serialized && request.serialized.has_serialized_tx)
+            out->serialized.append((const char *)request.serialized.serialized_tx.bytes,
+                                   request.serialized.serialized_tx.size);
+        if (request.request_type == RequestType_TXFINISHED) {
+            finished = true;
+            break;
+        }
+
+        uint32_t count = request.details.has_request_count ? request.details.request_count : 1;
+        for (uint32_t i = 0; i < count; i++) {
+            static TxAck ack;
+            memset(&ack, 0, sizeof(ack));
+            ack.has_tx = true;
+            if (!answer(w, request, request.details.request_index + i, &ack.tx)) {
+                ADD_FAILURE() << "no answer to request type " << request.request_type
+                              << " index " << request.details.request_index + i;
+                count = 0;
+                break;
+            }
+            std::string payload = encode(TxAck_fields, &ack);
+            EXPECT_TRUE(emulatorInprocSendMessage(INPROC_IFACE_MAIN,
+                                                  MessageType_MessageType_TxAck,
+                                                  payload.data(), payload.size()));
+        }
+        if (count == 0)
+            break;
+        while (emulatorInprocPending(INPROC_IFACE_MAIN))
+            usb_poll();
+    }
+
+    emulatorInprocSetTxHook(NULL, NULL);
+    if (!finished && out->failure == 0)
+        signing_abort();
+    return finished;
+}
+
+// The requests as "I0 O1 ...": pI/pO for the previous transaction's, M for
+// its metadata, F for TXFINISHED, and xN for a request_count.
+static std::string trace(const Signed &s) {
+    std::string out;
+    for (const TxRequest &req : s.requests) {
+        if (!out.empty())
+            out += " ";
+        if (req.details.has_tx_hash && req.request_type != RequestType_TXMETA)
+            out += "p";
+        switch (req.request_type) {
+        case RequestType_TXINPUT:    out += "I"; break;
+        case RequestType_TXOUTPUT:   out += "O"; break;
+        case RequestType_TXMETA:     out += "M"; continue;
+        case RequestType_TXFINISHED: out += "F"; continue;
+        default:                     out += "?"; break;
+        }
+        out += std::to_string(req.details.request_index);
+        if (req.details.has_request_count)
+            out += "x" + std::to_string(req.details.request_count);
+    }
+    return out;
+}
+
+TEST(InprocSigning, SerializedTx) {
+    boot();
+
+    const struct {
+        const char *name;
+        Wallet wallet;
+        const char *expected;
+        const char *trace;
+    } cases[] = {
+        // All-segwit: nothing is streamed twice before the witnesses.
+        { "native segwit", native_segwit_wallet(), NATIVE_SEGWIT_TX,
+          "I0 I1 I2 O0 O1 I0 I1 I2 F" },
+        { "p2sh segwit", p2sh_segwit_wallet(3, 100000, 250000, 340000), P2SH_SEGWIT_TX,
+          "I0 I1 I2 O0 O1 I0 I1 I2 F" },
+        // Phase 2 starts at the legacy input; the segwit inputs went out
+        // in Phase 1.
+        { "segwit then legacy", mixed_wallet(), MIXED_TX,
+          "I0 I1 I2 M pI0 pI1 pI2 pO0 pO1 pO2 O0 O1 I0 I1 I2 O0 O1 O0 O1 I0 I1 I2 F" },
+        { "segwit then force_bip143", force_bip143_wallet(), FORCE_BIP143_TX,
+          "I0 I1 O0 O1 I1 O0 O1 I0 I1 F" },
+    };
+
+    for (const auto &c : cases) {
+        SCOPED_TRACE(c.name);
+        static Signed s;
+        ASSERT_TRUE(sign_tx(c.wallet, 1, 0, &s));
+        EXPECT_EQ(trace(s), c.trace);
+        EXPECT_EQ(hex(s.serialized), c.expected);
+    }
+}
+
+
+TEST(InprocSigning, BatchedStreams) {
+    boot();
+
+    // The previous transaction's inputs and outputs and the Phase 2 input and
+    // output streams are batched; each batch stops at the end of its stream.
+    const struct {
+        uint32_t batch_size;
+        const char *trace;
+    } cases[] = {
+        { 2, "I0 I1 I2 M pI0x2 pI2 pO0x2 pO2 O0 O1 I0x2 I2 O0x2 O0 O1 I0 I1 I2 F" },
+        { 3, "I0 I1 I2 M pI0x3 pO0x3 O0 O1 I0x3 O0x2 O0 O1 I0 I1 I2 F" },
+        { 64, "I0 I1 I2 M pI0x3 pO0x3 O0 O1 I0x3 O0x2 O0 O1 I0 I1 I2 F" },
+    };
+
+    for (const auto &c : cases) {
+        SCOPED_TRACE("batch size " + std::to_string(c.batch_size));
+        static Signed s;
+        ASSERT_TRUE(sign_tx(mixed_wallet(), c.batch_size, 0, &s));
+        EXPECT_EQ(trace(s), c.trace);
+        EXPECT_EQ(hex(s.serialized), MIXED_TX);
+    }
+}
+
+TEST(InprocSigning, AbortMidBatch) {
+    boot();
+
+    // The spent output overflows the amount, in the middle of a batch of
+    // three. The Failure is the only reply: the last TxAck of the batch is
+    // dropped rather than answered with "Not in Signing mode".
+    Wallet w = mixed_wallet();
+    w.prev_outputs[1].amount = UINT64_MAX;
+    static Signed s;
+    EXPECT_FALSE(sign_tx(w, 3, 0, &s));
+    EXPECT_EQ(trace(s), "I0 I1 I2 M pI0x3 pO0x3");
+    EXPECT_EQ(s.failure, FailureType_Failure_SyntaxError);
+
+    // The next SignTx takes nothing over from the aborted batch.
+    ASSERT_TRUE(sign_tx(mixed_wallet(), 3, 0, &s));
+    EXPECT_EQ(hex(s.serialized), MIXED_TX);
+}
+
+
+// Every TxRequest carrying a signature also brings what it signed, and the
+// last of the held bytes come with TXFINISHED.
+static void expect_flushed(const Signed &s) {
+    std::string stream;
+    for (const TxRequest &req : s.requests) {
+        const TxRequestSerializedType &ser = req.serialized;
+        if (ser.has_serialized_tx)
+            stream.append((const char *)ser.serialized_tx.bytes, ser.serialized_tx.size);
+        if (ser.has_signature) {
+            EXPECT_TRUE(ser.has_serialized_tx) << "signature " << ser.signature_index;
+            EXPECT_NE(stream.find(std::string((const char *)ser.signature.bytes,
+                                              ser.signature.size)),
+                      std::string::npos)
+                << "signature " << ser.signature_index;
+        }
+    }
+    ASSERT_FALSE(s.requests.empty());
+    EXPECT_EQ(s.requests.back().request_type, RequestType_TXFINISHED);
+    EXPECT_TRUE(s.requests.back().serialized.has_serialized_tx);
+}
+
+TEST(InprocSigning, FlushedSerializedTx) {
+    boot();
+
+    const struct {
+        const char *name;
+        Wallet wallet;
+        const char *expected;
+    } cases[] = {
+        { "native segwit", native_segwit_wallet(), NATIVE_SEGWIT_TX },
+        { "p2sh segwit", p2sh_segwit_wallet(3, 100000, 250000, 340000), P2SH_SEGWIT_TX },
+        { "segwit then legacy", mixed_wallet(), MIXED_TX },
+        { "segwit then force_bip143", force_bip143_wallet(), FORCE_BIP143_TX },
+    };
+
+    for (const auto &c : cases) {
+        for (uint32_t batch_size : { 1, 3 }) {
+            for (uint32_t flush_interval : { 2, 3, 100 }) {
+                SCOPED_TRACE(std::string(c.name) + ", batch size " + std::to_string(batch_size) +
+                             ", flush interval " + std::to_string(flush_interval));
+                static Signed s;
+                ASSERT_TRUE(sign_tx(c.wallet, batch_size, flush_interval, &s));
+                EXPECT_EQ(hex(s.serialized), c.expected);
+                expect_flushed(s);
+            }
+        }
+    }
+
+    // The legacy input's empty witness and the lock time carry no signature,
+    // so only TXFINISHED flushes them.
+    static Signed s;
+    ASSERT_TRUE(sign_tx(mixed_wallet(), 1, 100, &s));
+    const TxRequestSerializedType &last = s.requests.back().serialized;
+    EXPECT_FALSE(last.has_signature);
+    EXPECT_EQ(hex(std::string((const char *)last.serialized_tx.bytes, last.serialized_tx.size)),
+              "0011000000");
+}
+
+TEST(InprocSigning, FlushBeforeHeldBytesOverflow) {
+    boot();
+
+    // Room is kept for an input with the largest scriptSig a TxAck can
+    // carry, so the header and the first five P2SH segwit inputs, 327 bytes,
+    // already go out with the request for the sixth, long before the flush
+    // interval.
+    static Signed s;
+    ASSERT_TRUE(sign_tx(p2sh_segwit_wallet(8, 100000, 500000, 3090000), 1, 100, &s));
+    EXPECT_EQ(hex(s.serialized), P2SH_SEGWIT_8_TX);
+    expect_flushed(s);
+
+    size_t first = 0;
+    while (first < s.requests.size() && !s.requests[first].serialized.has_serialized_tx)
+        first++;
+    ASSERT_EQ(first, 5u);
+    const TxRequest &req = s.requests[first];
+    EXPECT_EQ(req.request_type, RequestType_TXINPUT);
+    EXPECT_FALSE(req.serialized.has_signature);
+    EXPECT_EQ(req.serialized.serialized_tx.size, 7u + 5 * 64);
+}
+
+#endif
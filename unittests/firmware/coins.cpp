@@ -7,7 +7,9 @@ extern "C" {
 
 #include <sstream>
 #include <string>
+#include <cctype>
 #include <cstring>
+#include <strings.h>
 
 static const int MaxLength = 256;
 
@@ -82,3 +84,37 @@ TEST(Coins, TableSanity) {
             << "Contract address mismatch for " << coin.coin_shortcut;
     }
 }
+
+TEST(Coins, IndexedLookups) {
+    for (int i = 0; i < COINS_COUNT; ++i) {
+        const auto &coin = coins[i];
+
+        const CoinType *by_shortcut = nullptr, *by_name = nullptr;
+        const CoinType *by_address_type = nullptr, *by_slip44 = nullptr;
+        for (int j = 0; j < COINS_COUNT; ++j) {
+            if (!by_shortcut && strcasecmp(coin.coin_shortcut, coins[j].coin_shortcut) == 0)
+                by_shortcut = &coins[j];
+            if (!by_name && strcasecmp(coin.coin_name, coins[j].coin_name) == 0)
+                by_name = &coins[j];
+            if (!by_address_type && coin.address_type == coins[j].address_type)
+                by_address_type = &coins[j];
+            if (!by_slip44 && coin.bip44_account_path == coins[j].bip44_account_path)
+                by_slip44 = &coins[j];
+        }
+
+        EXPECT_EQ(by_shortcut, coinByShortcut(coin.coin_shortcut)) << coin.coin_shortcut;
+        EXPECT_EQ(by_name, coinByName(coin.coin_name)) << coin.coin_name;
+        EXPECT_EQ(by_address_type, coinByAddressType(coin.address_type)) << coin.coin_name;
+        EXPECT_EQ(by_slip44, coinBySlip44(coin.bip44_account_path)) << coin.coin_name;
+
+        std::string lower(coin.coin_name);
+        for (auto &c : lower)
+            c = tolower(c);
+        EXPECT_EQ(by_name, coinByName(lower.c_str())) << coin.coin_name;
+    }
+
+    EXPECT_EQ(nullptr, coinByShortcut("NOTACOIN"));
+    EXPECT_EQ(nullptr, coinByName("Not A Coin"));
+    EXPECT_EQ(nullptr, coinByName(nullptr));
+    EXPECT_EQ(nullptr, coinBySlip44(0x8fffffff));
+}
@@ -0,0 +1,52 @@
+extern "C" {
+#include "keepkey/firmware/crypto.h"
+#include "trezor/crypto/bip32.h"
+#include "trezor/crypto/curves.h"
+}
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+static void deriveUncached(HDNode *node, const uint32_t *address_n, size_t count) {
+    for (size_t i = 0; i < count; ++i)
+        ASSERT_EQ(hdnode_private_ckd(node, address_n[i]), 1);
+}
+
+TEST(Crypto, DerivationCache) {
+    static const uint8_t seed[64] = { 0x01, 0x02, 0x03, 0x04 };
+
+    HDNode root;
+    ASSERT_EQ(hdnode_from_seed(seed, sizeof(seed), SECP256K1_NAME, &root), 1);
+
+    cryptoClearDerivationCache();
+
+    for (uint32_t account = 0; account < 3; ++account) {
+        for (uint32_t index = 0; index < 4; ++index) {
+            const uint32_t address_n[] = { 0x80000000 | 44, 0x80000000 | 0,
+                                           0x80000000 | account, 0, index };
+
+            HDNode expected = root;
+            deriveUncached(&expected, address_n, 5);
+
+            HDNode actual = root;
+            uint32_t fingerprint;
+            ASSERT_EQ(cryptoDeriveNodeCached(&actual, address_n, 5, &fingerprint), 1);
+
+            EXPECT_EQ(actual.depth, expected.depth);
+            EXPECT_EQ(actual.child_num, expected.child_num);
+            EXPECT_EQ(memcmp(actual.chain_code, expected.chain_code, 32), 0);
+            EXPECT_EQ(memcmp(actual.private_key, expected.private_key, 32), 0);
+        }
+    }
+
+    uint32_t hits, misses;
+    cryptoGetDerivationCacheStats(&hits, &misses);
+    EXPECT_EQ(misses, 3u);
+    EXPECT_EQ(hits, 9u);
+
+    cryptoClearDerivationCache();
+    cryptoGetDerivationCacheStats(&hits, &misses);
+    EXPECT_EQ(hits, 0u);
+    EXPECT_EQ(misses, 0u);
+}
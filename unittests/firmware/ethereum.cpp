@@ -1,9 +1,12 @@
 extern "C" {
+#include "keepkey/firmware/coins.h"
+#include "keepkey/firmware/ethereum_tokens.h"
 #include "trezor/crypto/address.h"
 }
 
 #include "gtest/gtest.h"
 
+#include <cstring>
 #include <string>
 
 static uint8_t bin_from_ascii(char c) {
@@ -43,3 +46,67 @@ TEST(Ethereum, AddressChecksum) {
     test_checksum("dbF03B407c01E7cD3CBea99509d93f8DDDC8C6FB");
     test_checksum("D1220A0cf47c7B9Be7A2E6BA89F429762e7b9aDb");
 }
+
+static const TokenType *linearByChainAddress(uint8_t chain_id, const uint8_t *address) {
+    for (int i = 0; i < TOKENS_COUNT; i++) {
+        if (chain_id == tokens[i].chain_id && memcmp(address, tokens[i].address, 20) == 0)
+            return &tokens[i];
+    }
+    return UnknownToken;
+}
+
+static bool linearByTicker(uint8_t chain_id, const char *ticker, const TokenType **token) {
+    *token = nullptr;
+    for (int i = 0; i < TOKENS_COUNT; i++) {
+        if (chain_id == tokens[i].chain_id && strcmp(ticker, tokens[i].ticker + 1) == 0) {
+            if (*token)
+                return false;
+            *token = &tokens[i];
+        }
+    }
+    return *token;
+}
+
+static bool inLegacyTable(const char *ticker) {
+    for (int i = 0; i < COINS_COUNT; i++) {
+        if (coins[i].has_contract_address && strcmp(ticker, coins[i].coin_shortcut) == 0)
+            return true;
+    }
+    return false;
+}
+
+TEST(Ethereum, TokenIndex) {
+    for (int i = 0; i < TOKENS_COUNT; i++) {
+        const TokenType &token = tokens[i];
+        const uint8_t *address = (const uint8_t *)token.address;
+
+        EXPECT_EQ(linearByChainAddress(token.chain_id, address),
+                  tokenByChainAddress(token.chain_id, address))
+            << "Address lookup mismatch for " << token.ticker;
+
+        // Same address on a chain with no tokens.
+        EXPECT_EQ(UnknownToken, tokenByChainAddress(0, address));
+
+        const TokenType *expected, *actual;
+        bool expected_found = linearByTicker(token.chain_id, token.ticker + 1, &expected);
+        bool actual_found = tokenByTicker(token.chain_id, token.ticker + 1, &actual);
+
+        // tokenByTicker() consults the legacy coins table first, which the
+        // linear scan here doesn't model.
+        if (inLegacyTable(token.ticker + 1))
+            continue;
+
+        EXPECT_EQ(expected_found, actual_found)
+            << "Ticker lookup mismatch for " << token.ticker;
+        if (expected_found && actual_found)
+            EXPECT_EQ(expected, actual)
+                << "Ticker lookup mismatch for " << token.ticker;
+    }
+
+    uint8_t unknown[20];
+    memset(unknown, 0xee, sizeof(unknown));
+    EXPECT_EQ(UnknownToken, tokenByChainAddress(1, unknown));
+
+    const TokenType *token;
+    EXPECT_FALSE(tokenByTicker(1, "NOT A TOKEN", &token));
+}
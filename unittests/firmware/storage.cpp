@@ -2,6 +2,11 @@ extern "C" {
 #include "keepkey/firmware/storage.h"
 #include "keepkey/firmware/policy.h"
 #include "keepkey/board/keepkey_board.h"
+#include "keepkey/board/keepkey_flash.h"
+#include "keepkey/board/memory.h"
+#include "keepkey/board/timer.h"
+#include "keepkey/emulator/emulator.h"
+#include "keepkey/emulator/setup.h"
 #include "trezor/crypto/memzero.h"
 #include "types.pb.h"
 #include "storage.h"
@@ -12,6 +17,7 @@ extern "C" {
 
 #include <cstring>
 #include <string>
+#include <unistd.h>
 
 using ::testing::ElementsAreArray;
 
@@ -702,3 +708,194 @@ TEST(Storage, Reset) {
 
     ASSERT_TRUE(memcmp(new_storage_key, newest_storage_key, 64) == 0);
 }
+
+// Fresh, erased in-memory flash, and a storage image committed to it.
+static void journal_boot(void) {
+    static bool booted = false;
+    if (!booted) {
+        booted = true;
+        emulatorSetFlashPath(":memory:");
+        setup();
+        kk_timer_init();
+    }
+
+    flash_erase_word(FLASH_STORAGE1);
+    flash_erase_word(FLASH_STORAGE2);
+    flash_erase_word(FLASH_STORAGE3);
+    storage_init();
+}
+
+static Allocation active_sector(void) {
+    Allocation location = FLASH_INVALID;
+    EXPECT_TRUE(find_active_storage(&location));
+    return location;
+}
+
+static StorageJournalRecord *journal(void) {
+    return (StorageJournalRecord *)(flash_write_helper(active_sector()) +
+                                    STORAGE_JOURNAL_OFFSET);
+}
+
+static const size_t journal_slots = STORAGE_JOURNAL_LEN / sizeof(StorageJournalRecord);
+
+// Slots in use, valid or torn.
+static size_t journal_used(void) {
+    const StorageJournalRecord *rec = journal();
+    size_t i = 0;
+    while (i < journal_slots &&
+           !(rec[i].key == STORAGE_JOURNAL_ERASED && rec[i].value == STORAGE_JOURNAL_ERASED))
+        i++;
+    return i;
+}
+
+static void journal_write(size_t slot, uint32_t key, uint32_t value) {
+    StorageJournalRecord rec = { key, value };
+    ASSERT_TRUE(flash_write_word(active_sector(),
+                                 STORAGE_JOURNAL_OFFSET + slot * sizeof(rec),
+                                 sizeof(rec), (uint8_t *)&rec));
+}
+
+static uint32_t journal_key(StorageJournalKey key) {
+    return ((~(uint32_t)key & 0xffff) << 16) | key;
+}
+
+TEST(Storage, JournalReplay) {
+    journal_boot();
+    ASSERT_EQ(journal_used(), 0u);
+
+    storage_increasePinFails();
+    storage_increasePinFails();
+    storage_increasePinFails();
+    storage_nextU2FCounter();
+    uint32_t u2f = storage_nextU2FCounter();
+
+    // Each update is one record on top of the image, not a new image.
+    Allocation location = active_sector();
+    EXPECT_EQ(journal_used(), 5u);
+    EXPECT_EQ(journal()[2].key, journal_key(SJK_PinFails));
+    EXPECT_EQ(journal()[2].value, 3u);
+
+    // Reload from flash: the records are replayed over the image.
+    storage_init();
+    EXPECT_EQ(active_sector(), location);
+    EXPECT_EQ(storage_getPinFails(), 3u);
+    EXPECT_EQ(storage_nextU2FCounter(), u2f + 1);
+
+    storage_resetPinFails();
+    storage_init();
+    EXPECT_EQ(storage_getPinFails(), 0u);
+    EXPECT_EQ(journal_used(), 7u);
+}
+
+TEST(Storage, JournalTornRecord) {
+    journal_boot();
+
+    storage_increasePinFails();
+    ASSERT_EQ(journal_used(), 1u);
+
+    // Power lost between the value and the key write of the next record.
+    journal_write(1, STORAGE_JOURNAL_ERASED, 42);
+    storage_init();
+    EXPECT_EQ(storage_getPinFails(), 1u);
+
+    // A record with a mismatched key complement is skipped the same way.
+    journal_write(2, ((uint32_t)0x1234 << 16) | SJK_PinFails, 43);
+    storage_init();
+    EXPECT_EQ(storage_getPinFails(), 1u);
+
+    // New records go after the torn ones, and are replayed.
+    storage_increasePinFails();
+    EXPECT_EQ(journal_used(), 4u);
+    storage_init();
+    EXPECT_EQ(storage_getPinFails(), 2u);
+}
+
+TEST(Storage, JournalFullCommits) {
+    journal_boot();
+
+    for (size_t i = 0; i < journal_slots; i++)
+        storage_increasePinFails();
+    ASSERT_EQ(journal_used(), journal_slots);
+    ASSERT_EQ(storage_getPinFails(), journal_slots);
+
+    // No room for another record, so the whole image is committed instead,
+    // which leaves an empty journal behind.
+    storage_increasePinFails();
+    EXPECT_EQ(journal_used(), 0u);
+
+    storage_init();
+    EXPECT_EQ(storage_getPinFails(), journal_slots + 1);
+}
+
+TEST(Storage, JournalInvalidSectorCommits) {
+    journal_boot();
+
+    storage_increasePinFails();
+    Allocation location = active_sector();
+
+    // Storage is still pointed at this sector, but it no longer holds an
+    // image to journal against.
+    char magic[STORAGE_MAGIC_LEN];
+    memset(magic, 0, sizeof(magic));
+    ASSERT_TRUE(flash_write_word(location, 0, sizeof(magic), (uint8_t *)magic));
+
+    storage_increasePinFails();
+    EXPECT_EQ(journal_used(), 0u);
+
+    storage_init();
+    EXPECT_EQ(storage_getPinFails(), 2u);
+}
+
+TEST(Storage, CommitDropsJournal) {
+    journal_boot();
+
+    uint32_t u2f = storage_nextU2FCounter();
+    ASSERT_EQ(journal_used(), 1u);
+
+    // Put the counter back to what the image already holds, which commits
+    // right away. The image then matches RAM, but the journal would still
+    // replay the newer value, so the commit must not be skipped.
+    storage_setU2FCounter(u2f - 1);
+    EXPECT_EQ(journal_used(), 0u);
+
+    storage_init();
+    EXPECT_EQ(storage_nextU2FCounter(), u2f);
+
+    // With no journal records, an identical image still skips the write.
+    storage_commit();
+    Allocation location = active_sector();
+    storage_commit();
+    EXPECT_EQ(active_sector(), location);
+}
+
+TEST(Storage, SetU2FCounterCommits) {
+    journal_boot();
+    Allocation location = active_sector();
+
+    storage_setU2FCounter(1000);
+    EXPECT_NE(active_sector(), location);
+
+    storage_init();
+    EXPECT_EQ(storage_nextU2FCounter(), 1001u);
+}
+
+TEST(Storage, CommitDeferredWaitsForWindow) {
+    journal_boot();
+    Allocation location = active_sector();
+
+    storage_setLabel("deferred");
+    storage_commitDeferred();
+    storage_commitPending();
+    EXPECT_EQ(active_sector(), location);
+
+    // Let the window run out on the emulated timer.
+    usleep(600 * 1000);
+    timer_advance();
+    storage_commitPending();
+    EXPECT_NE(active_sector(), location);
+
+    // Nothing is left pending after the commit.
+    location = active_sector();
+    storage_commitPending();
+    EXPECT_EQ(active_sector(), location);
+}
@@ -1,11 +1,23 @@
 extern "C" {
 #include "keepkey/board/msg_dispatch.h"
 #include "keepkey/board/usb_driver.h"
+#include "keepkey/emulator/emulator.h"
 #include "keepkey/firmware/fsm.h"
+#include "messages.pb.h"
 }
 
 #include "gtest/gtest.h"
 
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
 extern "C" {
 void usb_rx_helper(UsbMessage *msg, MessageMapType type);
 }
@@ -40,3 +52,269 @@ TEST(USBRX, Overflow) {
     // Boom!
     usb_rx_helper(&msg, NORMAL_MSG);
 }
+
+// Segmented decoding, driven through the emulator's UDP transport: the first
+// report of a frame goes straight to usb_rx_helper(), and the decoder pulls
+// the rest in through usb_poll() while it runs.
+
+#define SEGMENT_TEST_PORT 21900
+
+static int host = -1;
+static struct sockaddr_in device[2];
+
+static MessagesMap_t test_map[MessageType_MessageType_DebugLinkDecision + 1];
+static std::vector<std::string> failures;
+static std::vector<std::string> signed_messages;
+static std::vector<std::string> coin_names;
+static int decisions;
+
+static void on_failure(FailureType code, const char *text) {
+    (void)code;
+    failures.push_back(text);
+}
+
+static void on_sign_message(void *ptr) {
+    SignMessage *msg = (SignMessage *)ptr;
+    signed_messages.push_back(std::string((const char *)msg->message.bytes, msg->message.size));
+    coin_names.push_back(msg->has_coin_name ? msg->coin_name : "");
+}
+
+#if DEBUG_LINK
+static void on_decision(void *ptr) {
+    EXPECT_TRUE(((DebugLinkDecision *)ptr)->yes_no);
+    decisions++;
+}
+#endif
+
+typedef std::vector<uint8_t> Report;
+
+// Split message contents into the 64 byte reports a host would send.
+static std::vector<Report> frame(uint16_t id, const std::vector<uint8_t> &contents) {
+    std::vector<Report> reports;
+    Report report(USB_SEGMENT_SIZE, 0);
+
+    TrezorFrame *header = (TrezorFrame *)report.data();
+    header->usb_header.hid_type = '?';
+    header->header.pre1 = '#';
+    header->header.pre2 = '#';
+    header->header.id = __builtin_bswap16(id);
+    header->header.len = __builtin_bswap32(contents.size());
+    size_t pos = sizeof(TrezorFrame);
+
+    for (uint8_t byte : contents) {
+        if (pos == USB_SEGMENT_SIZE) {
+            reports.push_back(report);
+            report.assign(USB_SEGMENT_SIZE, 0);
+            report[0] = '?';
+            pos = 1;
+        }
+        report[pos++] = byte;
+    }
+    reports.push_back(report);
+
+    return reports;
+}
+
+// SignMessage contents for the given message and coin name "Bitcoin".
+static std::vector<uint8_t> sign_message(const std::string &message) {
+    std::vector<uint8_t> contents = { 0x12 };
+    for (size_t len = message.size(); ; len >>= 7) {
+        contents.push_back((len & 0x7f) | (len > 0x7f ? 0x80 : 0));
+        if (len <= 0x7f)
+            break;
+    }
+    contents.insert(contents.end(), message.begin(), message.end());
+
+    const char coin_name[] = "Bitcoin";
+    contents.push_back(0x1a);
+    contents.push_back(sizeof(coin_name) - 1);
+    contents.insert(contents.end(), coin_name, coin_name + sizeof(coin_name) - 1);
+
+    return contents;
+}
+
+static std::string long_message(void) {
+    std::string message(1024, '\0');
+    for (size_t i = 0; i < message.size(); i++)
+        message[i] = (char)(i * 7);
+    return message;
+}
+
+static void deliver(const Report &report, MessageMapType type) {
+    UsbMessage msg;
+    memcpy(msg.message, report.data(), report.size());
+    msg.len = report.size();
+    usb_rx_helper(&msg, type);
+}
+
+// Queue reports on the device's socket for the decoder to poll.
+static void queue(const std::vector<Report> &reports, size_t begin, size_t end, int iface) {
+    for (size_t i = begin; i < end; i++) {
+        ASSERT_EQ(sendto(host, reports[i].data(), reports[i].size(), 0,
+                         (const struct sockaddr *)&device[iface], sizeof(device[iface])),
+                  (ssize_t)reports[i].size());
+    }
+}
+
+class SegmentStream : public ::testing::Test {
+protected:
+    static void SetUpTestCase() {
+        emulatorSetUdpPort(SEGMENT_TEST_PORT);
+        usb_init();
+
+        host = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        ASSERT_GE(host, 0);
+
+        for (int iface = 0; iface < 2; iface++) {
+            memset(&device[iface], 0, sizeof(device[iface]));
+            device[iface].sin_family = AF_INET;
+            device[iface].sin_port = htons(SEGMENT_TEST_PORT + iface);
+            device[iface].sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        }
+
+        test_map[MessageType_MessageType_SignMessage] = MessagesMap_t {
+            SignMessage_fields, &on_sign_message, PARSABLE, NORMAL_MSG, IN_MSG,
+            MessageType_MessageType_SignMessage, AnyVariant };
+#if DEBUG_LINK
+        test_map[MessageType_MessageType_DebugLinkDecision] = MessagesMap_t {
+            DebugLinkDecision_fields, &on_decision, PARSABLE, DEBUG_MSG, IN_MSG,
+            MessageType_MessageType_DebugLinkDecision, AnyVariant };
+#endif
+    }
+
+    static void TearDownTestCase() {
+        close(host);
+        host = -1;
+    }
+
+    void SetUp() override {
+        msg_map_init(test_map, sizeof(test_map) / sizeof(test_map[0]));
+        set_msg_failure_handler(&on_failure);
+        msg_init();
+
+        failures.clear();
+        signed_messages.clear();
+        coin_names.clear();
+        decisions = 0;
+    }
+
+    void TearDown() override {
+        fsm_init();
+    }
+
+    // A whole message still gets through after whatever the test did.
+    void expect_recovered() {
+        std::string message = long_message();
+        std::vector<Report> reports = frame(MessageType_MessageType_SignMessage,
+                                            sign_message(message));
+        size_t before = signed_messages.size();
+
+        queue(reports, 1, reports.size(), 0);
+        deliver(reports[0], NORMAL_MSG);
+
+        ASSERT_EQ(signed_messages.size(), before + 1);
+        EXPECT_EQ(signed_messages.back(), message);
+    }
+};
+
+TEST_F(SegmentStream, ManySegments) {
+    std::string message = long_message();
+    std::vector<Report> reports = frame(MessageType_MessageType_SignMessage,
+                                        sign_message(message));
+    ASSERT_EQ(reports.size(), 17u);
+
+    queue(reports, 1, reports.size(), 0);
+    deliver(reports[0], NORMAL_MSG);
+
+    ASSERT_EQ(signed_messages.size(), 1u);
+    EXPECT_EQ(signed_messages[0], message);
+    EXPECT_EQ(coin_names[0], "Bitcoin");
+    EXPECT_TRUE(failures.empty());
+
+    // The next frame starts cleanly after the last segment.
+    expect_recovered();
+    EXPECT_TRUE(failures.empty());
+}
+
+TEST_F(SegmentStream, StallTimesOut) {
+    std::vector<Report> reports = frame(MessageType_MessageType_SignMessage,
+                                        sign_message(long_message()));
+
+    // Only the first segment ever arrives, so the decoder waits out
+    // SEGMENT_STREAM_TIMEOUT_MS (1s) and gives up on the frame.
+    auto start = std::chrono::steady_clock::now();
+    deliver(reports[0], NORMAL_MSG);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_GE(elapsed, std::chrono::milliseconds(1000));
+    EXPECT_LT(elapsed, std::chrono::milliseconds(5000));
+    EXPECT_TRUE(signed_messages.empty());
+    ASSERT_EQ(failures.size(), 1u);
+    EXPECT_EQ(failures[0], "Could not parse protocol buffer message");
+
+    // The stalled frame is forgotten, so a new one starts from its header.
+    expect_recovered();
+    EXPECT_EQ(failures.size(), 1u);
+}
+
+#if DEBUG_LINK
+TEST_F(SegmentStream, OtherInterfaceMidDecode) {
+    std::string message = long_message();
+    std::vector<Report> reports = frame(MessageType_MessageType_SignMessage,
+                                        sign_message(message));
+    std::vector<uint8_t> yes = { 0x08, 0x01 };
+    std::vector<Report> decision = frame(MessageType_MessageType_DebugLinkDecision, yes);
+
+    // Half the message, then a debug link frame, then (once the decoder has
+    // had time to read that) the rest of the message.
+    queue(reports, 1, 9, 0);
+    queue(decision, 0, 1, 1);
+    std::thread rest([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        queue(reports, 9, reports.size(), 0);
+    });
+
+    deliver(reports[0], NORMAL_MSG);
+    rest.join();
+
+    ASSERT_EQ(signed_messages.size(), 1u);
+    EXPECT_EQ(signed_messages[0], message);
+    EXPECT_EQ(decisions, 0);
+    EXPECT_TRUE(failures.empty());
+
+    // Neither interface's framing was disturbed.
+    deliver(decision[0], DEBUG_MSG);
+    EXPECT_EQ(decisions, 1);
+    expect_recovered();
+    EXPECT_TRUE(failures.empty());
+}
+#endif
+
+TEST_F(SegmentStream, DecodeFailureDrainsFrame) {
+    // A 100 byte message field, then an unknown field with an invalid wire
+    // type in the second segment, padded out to five segments.
+    std::vector<uint8_t> contents = { 0x12, 100 };
+    contents.insert(contents.end(), 100, 'A');
+    contents.push_back(0x7f);
+    contents.resize(300, 0);
+
+    std::vector<Report> reports = frame(MessageType_MessageType_SignMessage, contents);
+    ASSERT_EQ(reports.size(), 5u);
+
+    queue(reports, 1, 2, 0);
+    deliver(reports[0], NORMAL_MSG);
+
+    EXPECT_TRUE(signed_messages.empty());
+    ASSERT_EQ(failures.size(), 1u);
+    EXPECT_EQ(failures[0], "Could not parse protocol buffer message");
+
+    // The rest of the frame is swallowed without another failure.
+    for (size_t i = 2; i < reports.size(); i++)
+        deliver(reports[i], NORMAL_MSG);
+
+    EXPECT_TRUE(signed_messages.empty());
+    EXPECT_EQ(failures.size(), 1u);
+
+    expect_recovered();
+    EXPECT_EQ(failures.size(), 1u);
+}